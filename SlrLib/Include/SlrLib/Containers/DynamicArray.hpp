@@ -2,6 +2,7 @@
 #ifndef SLR_CONTAINERS_DYNAMICARRAY
 #define SLR_CONTAINERS_DYNAMICARRAY
 
+#include <span>
 #include <utility>
 
 #include "SlrLib/Containers/Conformance.hpp"
@@ -103,7 +104,7 @@ public:
 	*/
 	Status Insert(const _Type& _value, const size _index)
 	{
-		SLR_ASSERT_ERROR(_index <= elements, "Invalid index provided to insert at")
+		SLR_ASSERT_ERROR_FORMAT(_index <= elements, "Invalid index {} provided to insert at, the array has {} elements", _index, elements)
 		{
 			return Status::FAIL;
 		}
@@ -160,7 +161,7 @@ public:
 	*/
 	Status Remove(const size _index)
 	{
-		SLR_ASSERT_ERROR(_index < elements, "Provided index is out-of-range")
+		SLR_ASSERT_ERROR_FORMAT(_index < elements, "Provided index {} is out-of-range for {} elements", _index, elements)
 		{
 			return Status::FAIL;
 		}
@@ -200,6 +201,40 @@ public:
 		return Status::SUCCESS;
 	}
 
+	/**
+	* Sets the number of elements contained within the array
+	* New elements are value initialized and removed elements have their destructor called. This will increase the capacity
+	* if necessary, but never decreases it.
+	*/
+	Status Resize(const size _elements)
+	{
+		// If there isn't enough room for the new elements
+		if (_elements > this->capacity)
+		{
+			Status status = SetCapacity(_elements);
+			SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not set capacity")
+			{
+				return Status::FAIL;
+			}
+		}
+
+		// Call the destructor for any elements past the new size
+		for (size index = _elements; index < this->elements; ++index)
+		{
+			buffer[index].~_Type();
+		}
+
+		// Construct any elements past the old size
+		for (size index = this->elements; index < _elements; ++index)
+		{
+			new(&buffer[index]) _Type();
+		}
+
+		this->elements = _elements;
+
+		return Status::SUCCESS;
+	}
+
 	/**
 	* Shrinks the capacity of the buffer to match the number of existing elements
 	*/
@@ -256,7 +291,7 @@ public:
 					status = MemRealloc<_Type>(buffer, _elements * elementSize);
 				}
 
-				SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not (re)allocate buffer")
+				SLR_ASSERT_ERROR_FORMAT(status == Status::SUCCESS, "Could not (re)allocate buffer for {} elements", _elements)
 				{
 					return Status::FAIL;
 				}
@@ -312,6 +347,28 @@ public:
 		return Status::SUCCESS;
 	}
 
+	/**
+	* Returns a view of the elements stored within the array
+	* The view is invalidated by any call which changes the capacity of the array
+	*/
+	inline Status GetSpan(SLR_RETURN(std::span<_Type>) _span)
+	{
+		_span = std::span<_Type>(this->buffer, this->elements);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a read-only view of the elements stored within the array
+	* The view is invalidated by any call which changes the capacity of the array
+	*/
+	inline Status GetSpan(SLR_RETURN(std::span<const _Type>) _span) const
+	{
+		_span = std::span<const _Type>(this->buffer, this->elements);
+
+		return Status::SUCCESS;
+	}
+
 	/**
 	* Returns the capacity of the array
 	*/
@@ -0,0 +1,204 @@
+#pragma once
+#ifndef SLR_ERRORHANDLING_ASYNCLOGGER
+#define SLR_ERRORHANDLING_ASYNCLOGGER
+
+#include <atomic>
+#include <cstdio>
+#include <source_location>
+#include <string_view>
+#include <thread>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/ErrorHandling/Logger.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* What an AsyncLogger does with a message when its queue is full
+*/
+enum class AsyncLoggerOverflow : word
+{
+	// The message is discarded
+	DROP,
+
+	// The logging thread waits until the writer has made space for the message
+	BLOCK,
+
+	// The message is discarded, and the writer logs a warning with the number of messages discarded since the last one
+	COUNT
+};
+
+/**
+* A logger which moves formatting and writing off of the logging thread
+* Logging a message copies it, along with its level and source location, into a fixed-size lock-free queue; a background
+* thread formats queued messages and writes them to the stream in batches, flushing the stream once per batch. Messages
+* longer than `maxMessageLength` are truncated.
+* Any number of threads may log concurrently. The logger must not be destroyed while another thread may still be logging,
+* which SetLogger<...>(...) does not guarantee; destroying it writes every queued message before returning. The installed
+* logger is destroyed at exit, and FlushLogger() waits for it to write what has been queued.
+* Example usage:
+*     SetLogger<AsyncLogger>(4096, AsyncLoggerOverflow::COUNT);
+*/
+class AsyncLogger : public Logger
+{
+public:
+	/**
+	* The maximum number of characters of a message which are kept
+	*/
+	static constexpr size maxMessageLength = 200;
+
+	/**
+	* Constructor
+	* _capacity is the number of messages which may be queued at once, and is rounded up to a power of two
+	* _overflow is what is done with a message logged while the queue is full
+	* _stream is where messages are written to; it is flushed after each batch but is never closed
+	* If the queue cannot be allocated, messages are formatted and written on the logging thread instead
+	*/
+	AsyncLogger(const size _capacity = 1024, const AsyncLoggerOverflow _overflow = AsyncLoggerOverflow::DROP, std::FILE* _stream = stdout);
+
+	/**
+	* Destructor
+	* Writes every queued message, then stops the writer thread
+	*/
+	~AsyncLogger() override;
+
+	AsyncLogger(const AsyncLogger&) = delete;
+	AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+	/**
+	* Override for the () operator to queue a message
+	*/
+	AsyncLogger& operator()(
+		const std::string_view,
+		const LogLevel,
+		const std::source_location&
+	) override;
+
+	/**
+	* Waits until every message queued before the call has been written and the stream has been flushed
+	*/
+	Status Flush() override;
+
+	/**
+	* Returns the number of messages which have been discarded because the queue was full
+	*/
+	inline Status GetDroppedCount(SLR_RETURN(size) _droppedCount) const
+	{
+		_droppedCount = this->droppedCount.load(std::memory_order_relaxed);
+
+		return Status::SUCCESS;
+	}
+
+private:
+	/**
+	* A queued message
+	* `sequence` follows Vyukov's bounded queue; a slot at position p can be written once `sequence` is p, and read once
+	* `sequence` is p + 1. Reading it sets `sequence` to p + capacity, making it writable on the next lap of the queue.
+	*/
+	struct Slot
+	{
+		std::atomic<size> sequence;
+		LogLevel level;
+		std::source_location sourceLocation;
+		size length;
+		char8 message[maxMessageLength];
+	};
+
+	/**
+	* The number of bytes the writer formats before writing them to the stream
+	*/
+	static constexpr size batchBytes = 16384;
+
+	/**
+	* The queued messages
+	*/
+	Slot* slots = nullptr;
+
+	/**
+	* The number of slots, which is a power of two
+	*/
+	size capacity = 0;
+
+	/**
+	* The position the next message will be queued at
+	*/
+	alignas(64) std::atomic<size> enqueuePosition = 0;
+
+	/**
+	* The position of the next message to be written; only the writer thread modifies this
+	*/
+	alignas(64) std::atomic<size> writtenPosition = 0;
+
+	/**
+	* The number of messages discarded because the queue was full
+	*/
+	std::atomic<size> droppedCount = 0;
+
+	/**
+	* The value of `droppedCount` when the writer last logged how many messages were discarded
+	*/
+	size reportedDroppedCount = 0;
+
+	/**
+	* Set by the writer thread before it waits on `wakeCount`, so that logging threads only wake it when it's asleep
+	*/
+	std::atomic<bool> isWriterSleeping = false;
+
+	/**
+	* Incremented to wake the writer thread
+	*/
+	std::atomic<u32> wakeCount = 0;
+
+	/**
+	* Set by the destructor to stop the writer thread once the queue has been emptied
+	*/
+	std::atomic<bool> isStopping = false;
+
+	/**
+	* What is done with a message logged while the queue is full
+	*/
+	const AsyncLoggerOverflow overflow;
+
+	/**
+	* Where messages are written to
+	*/
+	std::FILE* const stream;
+
+	/**
+	* The writer's batch buffer
+	*/
+	char8* batch = nullptr;
+
+	/**
+	* The thread which formats and writes queued messages
+	*/
+	std::thread writer;
+
+	/**
+	* Copies a message into the queue, applying the overflow policy if it's full
+	* Returns whether the message was queued
+	*/
+	bool Enqueue(const std::string_view, const LogLevel, const std::source_location&);
+
+	/**
+	* Wakes the writer thread if it's waiting for messages
+	*/
+	void WakeWriter();
+
+	/**
+	* The body of the writer thread
+	*/
+	void WriterLoop();
+
+	/**
+	* Formats and writes every message currently queued
+	* Returns the number of messages written
+	*/
+	size WriteQueued();
+};
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_ERRORHANDLING_ASYNCLOGGER
\ No newline at end of file
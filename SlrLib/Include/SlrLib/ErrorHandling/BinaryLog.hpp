@@ -0,0 +1,408 @@
+#pragma once
+#ifndef SLR_ERRORHANDLING_BINARYLOG
+#define SLR_ERRORHANDLING_BINARYLOG
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <source_location>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "SlrLib/Containers/DynamicArray.hpp"
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/ErrorHandling/Logger.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Utilities/Macros.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* How an argument of a binary log message is encoded
+* Integers are widened to 64 bits, and strings are written as a u32 length followed by their characters
+*/
+enum class BinaryLogArgument : u8
+{
+	SIGNED,
+	UNSIGNED,
+	FLOAT,
+	DOUBLE,
+	BOOL,
+	CHARACTER,
+	STRING,
+	POINTER
+};
+
+/**
+* Everything about a binary log call site which doesn't change between calls
+* This is registered once per call site and written to the log before any message which uses it
+*/
+struct BinaryLogDescriptor
+{
+	const char8* format;
+	LogLevel level;
+	std::source_location sourceLocation;
+	std::span<const BinaryLogArgument> arguments;
+};
+
+/**
+* A thread's buffer of encoded binary log messages
+* It's allocated on first use and written to the log when full, when flushed, or when the thread exits
+*/
+struct BinaryLogThreadBuffer
+{
+	byte* data = nullptr;
+	size used = 0;
+
+	// Zero until the buffer is allocated, so the first message takes the slow path
+	size capacity = 0;
+
+	/**
+	* Destructor
+	* Writes anything remaining to the log and frees the buffer
+	*/
+	~BinaryLogThreadBuffer();
+};
+
+/**
+* This class is purely to hide the implementation from the user to make it clear not to interact with anything contained
+* within
+*/
+class BinaryLogImplementation
+{
+public:
+	friend Status OpenBinaryLog(std::FILE*);
+	friend Status CloseBinaryLog();
+	friend Status FlushBinaryLog();
+	friend struct BinaryLogThreadBuffer;
+
+	/**
+	* The maximum number of characters of a string argument which are kept
+	*/
+	static constexpr size maxStringLength = 1024;
+
+	/**
+	* The size of each thread's buffer in bytes
+	*/
+	static constexpr size bufferBytes = 65536;
+
+	/**
+	* The encoding of an argument of type _Type
+	*/
+	template<typename _Type>
+	static constexpr BinaryLogArgument GetArgument()
+	{
+		using Type = std::remove_cv_t<_Type>;
+
+		if constexpr (std::is_same_v<Type, bool>)
+		{
+			return BinaryLogArgument::BOOL;
+		}
+		else if constexpr (std::is_same_v<Type, char8>)
+		{
+			return BinaryLogArgument::CHARACTER;
+		}
+		else if constexpr (std::is_enum_v<Type>)
+		{
+			return GetArgument<std::underlying_type_t<Type>>();
+		}
+		else if constexpr (std::is_integral_v<Type>)
+		{
+			return std::is_signed_v<Type> ? BinaryLogArgument::SIGNED : BinaryLogArgument::UNSIGNED;
+		}
+		else if constexpr (std::is_same_v<Type, float>)
+		{
+			return BinaryLogArgument::FLOAT;
+		}
+		else if constexpr (std::is_floating_point_v<Type>)
+		{
+			return BinaryLogArgument::DOUBLE;
+		}
+		else if constexpr (std::is_convertible_v<const Type&, std::string_view>)
+		{
+			return BinaryLogArgument::STRING;
+		}
+		else
+		{
+			static_assert(std::is_pointer_v<Type>, "Binary log arguments must be arithmetic, enums, strings or pointers");
+
+			return BinaryLogArgument::POINTER;
+		}
+	}
+
+	/**
+	* The encodings of each argument of a call site, in order
+	*/
+	template<typename ... _Arguments>
+	static constexpr std::array<BinaryLogArgument, sizeof...(_Arguments)> arguments = { GetArgument<_Arguments>()... };
+
+	/**
+	* Writes a message to the calling thread's buffer
+	* _CallSite is a lambda type unique to the call site, which gives every call site its own descriptor; use
+	* SLR_BINARY_LOG(...) rather than calling this directly
+	* _Level is a template parameter because it's recorded once in the descriptor rather than in each message
+	* _format must be a string literal, as only the pointer to it is kept
+	*/
+	template<LogLevel _Level, typename _CallSite, typename ... _Arguments>
+	static inline void Write(
+		_CallSite,
+		const std::source_location& _sourceLocation,
+		const char8* _format,
+		const _Arguments& ... _arguments
+	)
+	{
+		static const u32 descriptorId = RegisterDescriptor(BinaryLogDescriptor{
+			_format,
+			_Level,
+			_sourceLocation,
+			std::span<const BinaryLogArgument>(arguments<std::decay_t<const _Arguments>...>)
+		});
+
+		if (!isOpen.load(std::memory_order_relaxed) || !ExceptionImplementation::IsLevelEnabled(_Level) || descriptorId == invalidDescriptorId)
+		{
+			return;
+		}
+
+		const size recordBytes = sizeof(u32) + (GetEncodedSize<std::decay_t<const _Arguments>>(_arguments) + ... + 0);
+
+		BinaryLogThreadBuffer& buffer = threadBuffer;
+
+		if (buffer.capacity - buffer.used < recordBytes) [[unlikely]]
+		{
+			if (!MakeSpace(recordBytes))
+			{
+				return;
+			}
+		}
+
+		byte* cursor = buffer.data + buffer.used;
+
+		std::memcpy(cursor, &descriptorId, sizeof(u32));
+		cursor += sizeof(u32);
+
+		((cursor = Encode<std::decay_t<const _Arguments>>(cursor, _arguments)), ...);
+
+		buffer.used += recordBytes;
+	}
+
+private:
+	/**
+	* The ID given to a call site which could not be registered; messages from it are discarded
+	*/
+	static constexpr u32 invalidDescriptorId = ~static_cast<u32>(0);
+
+	/**
+	* Whether a log is currently open; messages are discarded while it isn't
+	*/
+	static inline std::atomic<bool> isOpen = false;
+
+	/**
+	* Guards `stream` and `descriptors`
+	*/
+	static std::mutex mutex;
+
+	/**
+	* The stream the log is written to, or nullptr if no log is open
+	*/
+	static std::FILE* stream;
+
+	/**
+	* Every call site registered so far, indexed by descriptor ID
+	*/
+	static DynamicArray<BinaryLogDescriptor> descriptors;
+
+	/**
+	* The calling thread's buffer
+	*/
+	static inline thread_local BinaryLogThreadBuffer threadBuffer;
+
+	/**
+	* Registers a call site, writing its descriptor to the log if one is open
+	* Returns the ID of the descriptor, or `invalidDescriptorId` if it could not be registered
+	*/
+	SLR_NOINLINE SLR_COLD static u32 RegisterDescriptor(const BinaryLogDescriptor& _descriptor);
+
+	/**
+	* Writes the calling thread's buffer to the log, allocating it first if necessary
+	* Returns whether there is now room for a record of _recordBytes bytes
+	*/
+	SLR_NOINLINE static bool MakeSpace(const size _recordBytes);
+
+	/**
+	* Writes the calling thread's buffer to the log
+	* `mutex` must be held by the caller
+	*/
+	static void FlushThreadBuffer(BinaryLogThreadBuffer& _buffer);
+
+	/**
+	* Writes a descriptor to `stream`
+	* `mutex` must be held by the caller
+	*/
+	static void WriteDescriptor(const u32 _descriptorId, const BinaryLogDescriptor& _descriptor);
+
+	/**
+	* Returns a string argument as a string_view
+	*/
+	template<typename _Type>
+	static inline std::string_view GetString(const _Type& _value)
+	{
+		if constexpr (std::is_pointer_v<_Type>)
+		{
+			// An empty literal rather than a default string_view, so the data pointer is never null
+			if (_value == nullptr)
+			{
+				return std::string_view("");
+			}
+		}
+
+		const std::string_view string(_value);
+
+		return string.substr(0, maxStringLength);
+	}
+
+	/**
+	* Returns the number of bytes an argument is encoded as
+	*/
+	template<typename _Type>
+	static inline size GetEncodedSize(const _Type& _value)
+	{
+		constexpr BinaryLogArgument argument = GetArgument<_Type>();
+
+		if constexpr (argument == BinaryLogArgument::STRING)
+		{
+			return sizeof(u32) + GetString(_value).size();
+		}
+		else if constexpr (argument == BinaryLogArgument::FLOAT)
+		{
+			return sizeof(float);
+		}
+		else if constexpr (argument == BinaryLogArgument::BOOL || argument == BinaryLogArgument::CHARACTER)
+		{
+			return sizeof(u8);
+		}
+		else
+		{
+			return sizeof(u64);
+		}
+	}
+
+	/**
+	* Encodes an argument at _cursor, returning the position after it
+	*/
+	template<typename _Type>
+	static inline byte* Encode(byte* _cursor, const _Type& _value)
+	{
+		constexpr BinaryLogArgument argument = GetArgument<_Type>();
+
+		if constexpr (argument == BinaryLogArgument::STRING)
+		{
+			const std::string_view string = GetString(_value);
+			const u32 length = static_cast<u32>(string.size());
+
+			std::memcpy(_cursor, &length, sizeof(u32));
+			std::memcpy(_cursor + sizeof(u32), string.data(), length);
+
+			return _cursor + sizeof(u32) + length;
+		}
+		else if constexpr (argument == BinaryLogArgument::SIGNED)
+		{
+			return EncodeValue(_cursor, static_cast<i64>(_value));
+		}
+		else if constexpr (argument == BinaryLogArgument::UNSIGNED)
+		{
+			return EncodeValue(_cursor, static_cast<u64>(_value));
+		}
+		else if constexpr (argument == BinaryLogArgument::FLOAT)
+		{
+			return EncodeValue(_cursor, static_cast<float>(_value));
+		}
+		else if constexpr (argument == BinaryLogArgument::DOUBLE)
+		{
+			return EncodeValue(_cursor, static_cast<double>(_value));
+		}
+		else if constexpr (argument == BinaryLogArgument::BOOL || argument == BinaryLogArgument::CHARACTER)
+		{
+			return EncodeValue(_cursor, static_cast<u8>(_value));
+		}
+		else
+		{
+			return EncodeValue(_cursor, static_cast<u64>(reinterpret_cast<std::uintptr_t>(_value)));
+		}
+	}
+
+	/**
+	* Copies the bytes of _value to _cursor, returning the position after it
+	*/
+	template<typename _Type>
+	static inline byte* EncodeValue(byte* _cursor, const _Type _value)
+	{
+		std::memcpy(_cursor, &_value, sizeof(_Type));
+
+		return _cursor + sizeof(_Type);
+	}
+};
+
+/**
+* Starts writing binary log messages to _stream, which must be opened in binary mode
+* Every call site registered so far is written to the stream first. The stream is not closed by the log.
+*/
+Status OpenBinaryLog(std::FILE* _stream);
+
+/**
+* Writes the calling thread's buffer to the log and stops logging
+* Other threads must flush their buffers before the log is closed, otherwise their messages are discarded
+*/
+Status CloseBinaryLog();
+
+/**
+* Writes the calling thread's buffer to the log and flushes the stream
+*/
+Status FlushBinaryLog();
+
+/**
+* Renders a binary log written by OpenBinaryLog(...) as text
+* Messages are grouped by the thread which logged them, in the order each thread's buffer was written. The log must be
+* decoded on a platform with the same endianness it was written on.
+*/
+Status DecodeBinaryLog(std::FILE* _input, std::FILE* _output);
+
+/**
+* Logs a message to the binary log
+* Only the call site's descriptor ID and the raw bytes of the arguments are written; the message is formatted when the log
+* is decoded. Each `{}` in the format is replaced with the next argument, and `{{` and `}}` are written as `{` and `}`.
+* _level must be a constant expression, as it's recorded once for the call site rather than with each message.
+* Example usage:
+*     SLR_BINARY_LOG(LogLevel::INFO, "Loaded {} entities in {} ms", entityCount, milliseconds);
+*/
+#define SLR_BINARY_LOG(_level, ...) \
+	BinaryLogImplementation::Write<(_level)>([]() {}, std::source_location::current(), __VA_ARGS__)
+
+/**
+* Logs a message of a specific level to the binary log, if the level is compiled in; refer to SLR_LOG_LEVEL
+*/
+#if SLR_LOG_LEVEL >= SLR_LOG_LEVEL_ERROR
+#define SLR_BINARY_LOG_ERROR(...) SLR_BINARY_LOG(LogLevel::ERROR, __VA_ARGS__)
+#else
+#define SLR_BINARY_LOG_ERROR(...) SLR_NO_OPERATION
+#endif
+
+#if SLR_LOG_LEVEL >= SLR_LOG_LEVEL_WARNING
+#define SLR_BINARY_LOG_WARNING(...) SLR_BINARY_LOG(LogLevel::WARNING, __VA_ARGS__)
+#else
+#define SLR_BINARY_LOG_WARNING(...) SLR_NO_OPERATION
+#endif
+
+#if SLR_LOG_LEVEL >= SLR_LOG_LEVEL_INFO
+#define SLR_BINARY_LOG_INFO(...) SLR_BINARY_LOG(LogLevel::INFO, __VA_ARGS__)
+#else
+#define SLR_BINARY_LOG_INFO(...) SLR_NO_OPERATION
+#endif
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_ERRORHANDLING_BINARYLOG
\ No newline at end of file
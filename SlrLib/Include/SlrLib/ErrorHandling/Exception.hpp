@@ -9,10 +9,17 @@
 #ifndef SLR_ERRORHANDLING_EXCEPTION
 #define SLR_ERRORHANDLING_EXCEPTION
 
+#include <atomic>
+#include <cstring>
+#include <source_location>
+#include <string_view>
 #include <type_traits>
+#include <utility>
 
 #include "SlrLib/ErrorHandling/Logger.hpp"
 #include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Utilities/Format.hpp"
+#include "SlrLib/Utilities/Macros.hpp"
 #include "SlrLib/Utilities/Types.hpp"
 
 SLR_NAMESPACE_BEGIN
@@ -50,40 +57,214 @@ static_assert(
 class ExceptionImplementation
 {
 public:
-	template<typename>
-	friend void SetLogger();
+	template<typename _Logger, typename ... _Arguments>
+	friend void SetLogger(_Arguments&& ...);
+
+	friend void SetLogLevel(const LogLevel);
+
+	friend Status FlushLogger();
 
 	/**
 	* Returns a pointer to the logger
+	* This is nullptr once the logger has been destroyed at exit
 	*/
-	static inline constexpr Logger* GetLogger()
+	static inline Logger* GetLogger()
 	{
 		return ExceptionImplementation::logger;
 	}
 
+	/**
+	* Passes a message to the logger, without checking the runtime log level
+	* Messages logged after the logger has been destroyed at exit, such as from the destructors of other static objects, are
+	* written by a temporary DefaultLogger instead
+	*/
+	static inline void Log(const std::string_view _message, const LogLevel _level, const std::source_location& _sourceLocation)
+	{
+		Logger* logger = ExceptionImplementation::GetLogger();
+
+		if (logger == nullptr) [[unlikely]]
+		{
+			DefaultLogger()(_message, _level, _sourceLocation);
+
+			return;
+		}
+
+		logger->operator()(_message, _level, _sourceLocation);
+	}
+
+	/**
+	* Returns whether messages of _level pass the runtime log level
+	* This is checked before calling the logger so filtered messages never reach the virtual call
+	*/
+	static inline bool IsLevelEnabled(const LogLevel _level)
+	{
+		return static_cast<word>(_level) <= ExceptionImplementation::logLevel.load(std::memory_order_relaxed);
+	}
+
+	/**
+	* Logs _message at _level if it passes the runtime log level, then returns true
+	* This is called by the assertion macros on failure; it is kept out of line so the failure path doesn't bloat the
+	* function containing the assertion. _sourceLocation defaults to where the macro was expanded.
+	*/
+	SLR_NOINLINE SLR_COLD static bool LogMessage(
+		const std::string_view _message,
+		const LogLevel _level,
+		const std::source_location& _sourceLocation = std::source_location::current()
+	)
+	{
+		if (ExceptionImplementation::IsLevelEnabled(_level))
+		{
+			ExceptionImplementation::Log(_message, _level, _sourceLocation);
+		}
+
+		return true;
+	}
+
+	/**
+	* Formats a message at _level into the calling thread's format buffer and logs it, then returns true
+	* Nothing is formatted if _level doesn't pass the runtime log level. Messages which don't fit in the buffer are cut short
+	* and end with "...". Refer to FormatTo(...) for the format syntax.
+	*/
+	template<typename ... _Arguments>
+	SLR_NOINLINE SLR_COLD static bool LogFormatted(
+		const LogLevel _level,
+		const std::source_location& _sourceLocation,
+		const std::string_view _format,
+		const _Arguments& ... _arguments
+	)
+	{
+		if (ExceptionImplementation::IsLevelEnabled(_level))
+		{
+			const FormatResult result = FormatTo(ExceptionImplementation::formatBuffer, _format, _arguments...);
+
+			if (result.isTruncated)
+			{
+				std::memcpy(ExceptionImplementation::formatBuffer + result.length - 3, "...", 3);
+			}
+
+			ExceptionImplementation::Log(
+				std::string_view(ExceptionImplementation::formatBuffer, result.length),
+				_level,
+				_sourceLocation
+			);
+		}
+
+		return true;
+	}
+
 private:
+	/**
+	* Destroys the logger at exit, so it can write anything it has buffered
+	*/
+	struct LoggerLifetime
+	{
+		constexpr LoggerLifetime() = default;
+
+		inline ~LoggerLifetime()
+		{
+			Logger* logger = nullptr;
+
+			std::swap(ExceptionImplementation::logger, logger);
+
+			delete logger;
+		}
+	};
+
 	/**
 	* A pointer to the logger object
 	*/
 	static inline Logger* logger = new DefaultLogger();
+
+	/**
+	* Owns `logger`; this must be declared after it so it's initialized after, and therefore destroyed before, it
+	*/
+	static inline LoggerLifetime loggerLifetime;
+
+	/**
+	* The most verbose level of message which is passed to the logger
+	*/
+	static inline std::atomic<word> logLevel = static_cast<word>(LogLevel::INFO);
+
+	/**
+	* The buffer formatted messages are written to before being passed to the logger
+	* The logger must copy the message if it needs it after returning
+	*/
+	static inline thread_local char8 formatBuffer[512];
 };
 
 /**
 * Sets the logger to be used when logging messages
-* The logger type must inherit from Logger
+* The logger type must inherit from Logger, and is constructed with _arguments
+* The new logger is constructed before the current logger is deleted, so the constructor may still log messages
 */
-template<typename _Logger>
-void SetLogger()
+template<typename _Logger, typename ... _Arguments>
+void SetLogger(_Arguments&& ... _arguments)
 {
 	static_assert(std::is_base_of<Logger, _Logger>::value, "Logger type must inherit from Logger");
 
-	// Delete the current logger
-	delete ExceptionImplementation::logger;
-
 	// Create new logger with specified type
-	ExceptionImplementation::logger = new _Logger();
+	Logger* logger = new _Logger(std::forward<_Arguments>(_arguments)...);
+
+	// Swap in the new logger, then delete the previous one
+	std::swap(ExceptionImplementation::logger, logger);
+
+	delete logger;
+}
+
+/**
+* Writes any messages the logger has buffered
+* The logger is also destroyed at exit, which writes anything it has buffered, so this is only needed to make messages
+* visible sooner, such as before a likely crash
+*/
+inline Status FlushLogger()
+{
+	Logger* logger = ExceptionImplementation::GetLogger();
+
+	if (logger == nullptr)
+	{
+		return Status::SUCCESS;
+	}
+
+	return logger->Flush();
+}
+
+/**
+* Sets the most verbose level of message which is passed to the logger
+* This can only filter levels which were compiled in; refer to SLR_LOG_LEVEL
+*/
+inline void SetLogLevel(const LogLevel _level)
+{
+	ExceptionImplementation::logLevel.store(static_cast<word>(_level), std::memory_order_relaxed);
 }
 
+/**
+* Logs _message, or a message formatted from a format and its arguments, at the given level and evaluates to true
+* If the level isn't compiled in, refer to SLR_LOG_LEVEL, this is just true and the message is never evaluated
+*/
+#if SLR_LOG_LEVEL >= SLR_LOG_LEVEL_ERROR
+#define SLR_LOG_ERROR_MESSAGE(_message) ExceptionImplementation::LogMessage(_message, LogLevel::ERROR)
+#define SLR_LOG_ERROR_FORMAT(...) ExceptionImplementation::LogFormatted(LogLevel::ERROR, std::source_location::current(), __VA_ARGS__)
+#else
+#define SLR_LOG_ERROR_MESSAGE(_message) true
+#define SLR_LOG_ERROR_FORMAT(...) true
+#endif
+
+#if SLR_LOG_LEVEL >= SLR_LOG_LEVEL_WARNING
+#define SLR_LOG_WARNING_MESSAGE(_message) ExceptionImplementation::LogMessage(_message, LogLevel::WARNING)
+#define SLR_LOG_WARNING_FORMAT(...) ExceptionImplementation::LogFormatted(LogLevel::WARNING, std::source_location::current(), __VA_ARGS__)
+#else
+#define SLR_LOG_WARNING_MESSAGE(_message) true
+#define SLR_LOG_WARNING_FORMAT(...) true
+#endif
+
+#if SLR_LOG_LEVEL >= SLR_LOG_LEVEL_INFO
+#define SLR_LOG_INFO_MESSAGE(_message) ExceptionImplementation::LogMessage(_message, LogLevel::INFO)
+#define SLR_LOG_INFO_FORMAT(...) ExceptionImplementation::LogFormatted(LogLevel::INFO, std::source_location::current(), __VA_ARGS__)
+#else
+#define SLR_LOG_INFO_MESSAGE(_message) true
+#define SLR_LOG_INFO_FORMAT(...) true
+#endif
+
 /**
 * If _condition evaluates to false, _message will be logged as an error and the body of the macro will be executed
 * Example usage:
@@ -95,40 +276,32 @@ void SetLogger()
 * The majority of the time, this should just return Status::FAIL, though there may be some circumstances where the exception
 * would require some clean-up of resources, in which case, that would be handled within the body of the macro, then also
 * likely return FAIL
+* _condition is evaluated exactly once; the logging on failure is done out of line and the body is marked as unlikely
 */
 #define SLR_ASSERT_ERROR(_condition, _message) \
-	if (static_cast<bool>(_condition) == false) { \
-		ExceptionImplementation::GetLogger()->operator()(_message, LogLevel::ERROR); \
-	} \
-	if (static_cast<bool>(_condition) == false)
+	if (static_cast<bool>(_condition) == false && SLR_LOG_ERROR_MESSAGE(_message)) [[unlikely]]
 
 /**
 * If _condition evaluates to false, _message is logged as a warning and the body of the macro will be executed
 * Refer to SLR_ASSERT_ERROR(...) for full explanation of this mechanism
 */
 #define SLR_ASSERT_WARNING(_condition, _message) \
-	if (static_cast<bool>(_condition) == false) { \
-		ExceptionImplementation::GetLogger()->operator()(_message, LogLevel::WARNING); \
-	} \
-	if (static_cast<bool>(_condition) == false)
+	if (static_cast<bool>(_condition) == false && SLR_LOG_WARNING_MESSAGE(_message)) [[unlikely]]
 
 /**
 * If _condition evaluates to false, _message is logged as info and the body of the macro will be executed
 * Refer to SLR_ASSERT_ERROR(...) for full explanation of this mechanism
 */
 #define SLR_ASSERT_INFO(_condition, _message) \
-	if (static_cast<bool>(_condition) == false) { \
-		ExceptionImplementation::GetLogger()->operator()(_message, LogLevel::INFO); \
-	} \
-	if (static_cast<bool>(_condition) == false)
+	if (static_cast<bool>(_condition) == false && SLR_LOG_INFO_MESSAGE(_message)) [[unlikely]]
 
 /**
 * Logs an error if _condition evaluates to false
 */
 #define SLR_ERROR(_condition, _message) \
 	do { \
-		if (static_cast<bool>(_condition) == false) { \
-			ExceptionImplementation::GetLogger()->operator()(_message, LogLevel::ERROR); \
+		if (static_cast<bool>(_condition) == false) [[unlikely]] { \
+			static_cast<void>(SLR_LOG_ERROR_MESSAGE(_message)); \
 		} \
 	} while (0)
 
@@ -137,8 +310,8 @@ void SetLogger()
 */
 #define SLR_WARNING(_condition, _message) \
 	do { \
-		if (static_cast<bool>(_condition) == false) { \
-			ExceptionImplementation::GetLogger()->operator()(_message, LogLevel::WARNING); \
+		if (static_cast<bool>(_condition) == false) [[unlikely]] { \
+			static_cast<void>(SLR_LOG_WARNING_MESSAGE(_message)); \
 		} \
 	} while (0)
 
@@ -147,8 +320,62 @@ void SetLogger()
 */
 #define SLR_INFO(_condition, _message) \
 	do { \
-		if (static_cast<bool>(_condition) == false) { \
-			ExceptionImplementation::GetLogger()->operator()(_message, LogLevel::INFO); \
+		if (static_cast<bool>(_condition) == false) [[unlikely]] { \
+			static_cast<void>(SLR_LOG_INFO_MESSAGE(_message)); \
+		} \
+	} while (0)
+
+/**
+* Equivalent to SLR_ASSERT_ERROR(...), but the message is formatted from a format and its arguments
+* The message is only formatted if the condition fails and the level is enabled, and nothing is allocated
+* Example usage:
+*     SLR_ASSERT_ERROR_FORMAT(_index < elements, "Index {} is out of range for {} elements", _index, elements)
+*     {
+*         return Status::FAIL;
+*     }
+*/
+#define SLR_ASSERT_ERROR_FORMAT(_condition, ...) \
+	if (static_cast<bool>(_condition) == false && SLR_LOG_ERROR_FORMAT(__VA_ARGS__)) [[unlikely]]
+
+/**
+* Equivalent to SLR_ASSERT_WARNING(...), but the message is formatted from a format and its arguments
+*/
+#define SLR_ASSERT_WARNING_FORMAT(_condition, ...) \
+	if (static_cast<bool>(_condition) == false && SLR_LOG_WARNING_FORMAT(__VA_ARGS__)) [[unlikely]]
+
+/**
+* Equivalent to SLR_ASSERT_INFO(...), but the message is formatted from a format and its arguments
+*/
+#define SLR_ASSERT_INFO_FORMAT(_condition, ...) \
+	if (static_cast<bool>(_condition) == false && SLR_LOG_INFO_FORMAT(__VA_ARGS__)) [[unlikely]]
+
+/**
+* Equivalent to SLR_ERROR(...), but the message is formatted from a format and its arguments
+*/
+#define SLR_ERROR_FORMAT(_condition, ...) \
+	do { \
+		if (static_cast<bool>(_condition) == false) [[unlikely]] { \
+			static_cast<void>(SLR_LOG_ERROR_FORMAT(__VA_ARGS__)); \
+		} \
+	} while (0)
+
+/**
+* Equivalent to SLR_WARNING(...), but the message is formatted from a format and its arguments
+*/
+#define SLR_WARNING_FORMAT(_condition, ...) \
+	do { \
+		if (static_cast<bool>(_condition) == false) [[unlikely]] { \
+			static_cast<void>(SLR_LOG_WARNING_FORMAT(__VA_ARGS__)); \
+		} \
+	} while (0)
+
+/**
+* Equivalent to SLR_INFO(...), but the message is formatted from a format and its arguments
+*/
+#define SLR_INFO_FORMAT(_condition, ...) \
+	do { \
+		if (static_cast<bool>(_condition) == false) [[unlikely]] { \
+			static_cast<void>(SLR_LOG_INFO_FORMAT(__VA_ARGS__)); \
 		} \
 	} while (0)
 
@@ -0,0 +1,194 @@
+#pragma once
+#ifndef SLR_ERRORHANDLING_FILELOGGER
+#define SLR_ERRORHANDLING_FILELOGGER
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <source_location>
+#include <string>
+#include <string_view>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/ErrorHandling/Logger.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* How a FileLogger buffers, flushes and rotates its files
+*/
+struct FileLoggerOptions
+{
+	// The number of bytes of formatted messages held in memory before they're written to the file
+	size bufferBytes = 65536;
+
+	// Buffered messages are also written once this long has passed since the last write, checked when a message is logged
+	std::chrono::milliseconds flushInterval = std::chrono::milliseconds(1000);
+
+	// The file is rotated before it would grow beyond this many bytes; 0 never rotates it
+	u64 maxFileBytes = 0;
+
+	// The number of rotated files kept, named `<path>.1` (the newest) to `<path>.<maxFileCount>`
+	size maxFileCount = 4;
+
+	// Whether error messages are written and synced to the disk immediately, so they survive a crash
+	bool isSyncedOnError = false;
+};
+
+/**
+* A logger which appends messages to a file
+* Messages are formatted into a userspace buffer, which is written to the file in a single system call once it's full,
+* once `flushInterval` has passed, on Flush() or when the logger is destroyed, which for the installed logger happens at
+* exit; use FlushLogger() to flush the installed logger. A message which doesn't fit in the buffer is written together with
+* it using a gather write.
+* Any number of threads may log concurrently; messages are serialized by a mutex. Failures while writing can't be logged,
+* as that would log through this logger, so the affected messages are discarded and counted instead.
+* Example usage:
+*     FileLoggerOptions options;
+*     options.maxFileBytes = 16 * 1024 * 1024;
+*     SetLogger<FileLogger>("SlrLib.log", options);
+*/
+class FileLogger : public Logger
+{
+public:
+	/**
+	* Constructor
+	* _path is the file messages are appended to; it's created if it doesn't exist
+	* If the file or the buffer cannot be created, messages are written to the standard output, unbuffered, instead
+	*/
+	FileLogger(const std::string_view _path, const FileLoggerOptions& _options = FileLoggerOptions());
+
+	/**
+	* Destructor
+	* Writes any buffered messages and closes the file
+	*/
+	~FileLogger() override;
+
+	FileLogger(const FileLogger&) = delete;
+	FileLogger& operator=(const FileLogger&) = delete;
+
+	/**
+	* Override for the () operator to log a message
+	*/
+	FileLogger& operator()(
+		const std::string_view,
+		const LogLevel,
+		const std::source_location&
+	) override;
+
+	/**
+	* Writes any buffered messages to the file
+	*/
+	Status Flush() override;
+
+	/**
+	* Returns the number of messages which have been discarded because they couldn't be written
+	*/
+	inline Status GetDroppedCount(SLR_RETURN(size) _droppedCount)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		_droppedCount = this->droppedCount;
+
+		return Status::SUCCESS;
+	}
+
+private:
+	/**
+	* The longest a single formatted message may be
+	*/
+	static constexpr size maxLineBytes = 1024;
+
+	/**
+	* The value of `file` when no file is open; this matches both -1 for a POSIX descriptor and INVALID_HANDLE_VALUE
+	*/
+	static constexpr std::intptr_t invalidFile = -1;
+
+	/**
+	* How the logger buffers, flushes and rotates its files
+	*/
+	const FileLoggerOptions options;
+
+	/**
+	* The path of the current file
+	*/
+	const std::string path;
+
+	/**
+	* Serializes logging threads
+	*/
+	std::mutex mutex;
+
+	/**
+	* The current file, as a POSIX file descriptor or a Windows HANDLE
+	*/
+	std::intptr_t file = invalidFile;
+
+	/**
+	* Whether `file` is the standard output, in which case it's never closed or rotated
+	*/
+	bool isStandardOutput = false;
+
+	/**
+	* The size of the current file, including what has been buffered
+	*/
+	u64 fileBytes = 0;
+
+	/**
+	* Formatted messages waiting to be written
+	*/
+	char8* buffer = nullptr;
+
+	/**
+	* The number of bytes used in `buffer`
+	*/
+	size bufferUsed = 0;
+
+	/**
+	* The number of messages in `buffer`
+	*/
+	size bufferedCount = 0;
+
+	/**
+	* The capacity of `buffer`; 0 if it couldn't be allocated, in which case every message is written immediately
+	*/
+	size bufferCapacity = 0;
+
+	/**
+	* When the buffer was last written to the file
+	*/
+	std::chrono::steady_clock::time_point lastFlushTime;
+
+	/**
+	* The number of messages discarded because they couldn't be written
+	*/
+	size droppedCount = 0;
+
+	/**
+	* Writes the buffer, followed by _line, to the file and empties the buffer
+	* _line may be empty. The caller must hold `mutex`.
+	*/
+	Status WriteBuffer(const std::string_view _line);
+
+	/**
+	* Closes the current file, shifts each rotated file along by one, discarding the oldest, and opens a new file
+	* The caller must hold `mutex` and have written the buffer.
+	*/
+	Status Rotate();
+
+	/**
+	* Opens `path` for appending, and sets `fileBytes` to its current size
+	*/
+	Status Open();
+
+	/**
+	* Closes the current file, unless it's the standard output
+	*/
+	void Close();
+};
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_ERRORHANDLING_FILELOGGER
\ No newline at end of file
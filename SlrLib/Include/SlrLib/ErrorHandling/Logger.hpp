@@ -18,6 +18,9 @@ SLR_NAMESPACE_BEGIN
 #undef ERROR
 #endif
 
+// Declared in Exception.hpp, which includes this file
+enum class Status : word;
+
 /**
 * The log level of a logged message
 * The different level will format the message differently with more or less info, based on the loggers discretion
@@ -29,6 +32,28 @@ enum class LogLevel : word
 	INFO
 };
 
+/**
+* The values SLR_LOG_LEVEL may be defined as, which match the values of LogLevel
+* These are macros so they can be compared by the preprocessor; SLR_LOG_LEVEL_NONE disables all logging
+*/
+#define SLR_LOG_LEVEL_NONE (-1)
+#define SLR_LOG_LEVEL_ERROR 0
+#define SLR_LOG_LEVEL_WARNING 1
+#define SLR_LOG_LEVEL_INFO 2
+
+/**
+* The most verbose level of message which is compiled in
+* Logging of any level above this is removed by the preprocessor, leaving only the condition and the body of the assertion
+* Define this before including any SlrLib header, or for the whole project, to change it
+*/
+#ifndef SLR_LOG_LEVEL
+#define SLR_LOG_LEVEL SLR_LOG_LEVEL_INFO
+#endif
+
+static_assert(static_cast<word>(LogLevel::ERROR) == SLR_LOG_LEVEL_ERROR, "SLR_LOG_LEVEL_ERROR must match LogLevel::ERROR");
+static_assert(static_cast<word>(LogLevel::WARNING) == SLR_LOG_LEVEL_WARNING, "SLR_LOG_LEVEL_WARNING must match LogLevel::WARNING");
+static_assert(static_cast<word>(LogLevel::INFO) == SLR_LOG_LEVEL_INFO, "SLR_LOG_LEVEL_INFO must match LogLevel::INFO");
+
 // Redefines ERROR to its initial value, if it was originally defined
 #ifdef SLR_INITIAL_ERROR_VALUE
 #define ERROR SLR_INITIAL_ERROR_VALUE
@@ -54,10 +79,30 @@ public:
 		const std::source_location& = std::source_location::current()
 	) = 0;
 
+	/**
+	* Writes any messages the logger has buffered
+	* Loggers which write every message immediately don't need to override this
+	*/
+	virtual Status Flush();
+
 	/**
 	* Virtual destructor
+	* Loggers which buffer messages must write them before being destroyed
 	*/
 	virtual ~Logger() = default;
+
+	/**
+	* Returns the prefix written before a message of the given log level, such as "[Error]"
+	*/
+	static const char* GetPrefix(const LogLevel);
+
+protected:
+	/**
+	* Formats a message as a single line into _buffer, truncating it to _bufferSize bytes
+	* Errors also include the file and line they were logged from
+	* Returns the number of bytes written, not including the null terminator
+	*/
+	static size Format(char8* _buffer, const size _bufferSize, const std::string_view, const LogLevel, const std::source_location&);
 };
 
 /**
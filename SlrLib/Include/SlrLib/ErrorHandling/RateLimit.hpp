@@ -0,0 +1,295 @@
+/**
+* Like Exception.hpp, the functions contained within this file are used while logging, therefore they do not return Status
+* and must never log a message themselves.
+*/
+
+#pragma once
+#ifndef SLR_ERRORHANDLING_RATELIMIT
+#define SLR_ERRORHANDLING_RATELIMIT
+
+#include <atomic>
+#include <chrono>
+#include <source_location>
+#include <string_view>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/ErrorHandling/Logger.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Utilities/Macros.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* How often a rate limited call site may log
+* The first `firstCount` failures are always logged. After that, if `intervalNanoseconds` is non-zero, at most one failure
+* is logged per interval; otherwise every `everyCount`th failure is logged, or none if `everyCount` is zero. Whenever a
+* failure is logged after others were suppressed, the message notes how many were suppressed.
+*/
+struct LogRateLimit
+{
+	u64 firstCount;
+	u64 everyCount;
+	u64 intervalNanoseconds;
+
+	/**
+	* Only the first _count failures are logged
+	*/
+	static constexpr LogRateLimit First(const u64 _count)
+	{
+		return LogRateLimit{ _count, 0, 0 };
+	}
+
+	/**
+	* The first _count failures are logged, then every _every-th failure
+	*/
+	static constexpr LogRateLimit FirstThenEvery(const u64 _count, const u64 _every)
+	{
+		return LogRateLimit{ _count, _every, 0 };
+	}
+
+	/**
+	* At most one failure is logged per _interval
+	*/
+	static constexpr LogRateLimit Interval(const std::chrono::nanoseconds _interval)
+	{
+		return LogRateLimit{ 0, 0, static_cast<u64>(_interval.count()) };
+	}
+};
+
+/**
+* The state of a single rate limited call site
+* This is created by SLR_LOG_RATE_LIMITER(...), which gives each call site its own constant initialized limiter. All of the
+* bookkeeping is lock-free; a suppressed failure costs a single relaxed atomic increment, plus reading the clock when the
+* limit is an interval.
+*/
+class LogRateLimiter
+{
+public:
+	/**
+	* Constructor
+	*/
+	constexpr LogRateLimiter(const LogRateLimit _limit) : limit(_limit) {}
+
+	LogRateLimiter(const LogRateLimiter&) = delete;
+	LogRateLimiter& operator=(const LogRateLimiter&) = delete;
+
+	/**
+	* Records a failure and returns whether it should be logged
+	* If it should, _suppressedCount is set to the number of failures which were suppressed since the last one logged
+	*/
+	inline bool ShouldLog(u64& _suppressedCount)
+	{
+		const u64 failure = failureCount.fetch_add(1, std::memory_order_relaxed);
+
+		if (failure < limit.firstCount)
+		{
+			_suppressedCount = 0;
+
+			if (limit.intervalNanoseconds != 0)
+			{
+				lastLoggedFailure.store(failure, std::memory_order_relaxed);
+			}
+
+			return true;
+		}
+
+		if (limit.intervalNanoseconds == 0)
+		{
+			if (limit.everyCount == 0 || (failure - limit.firstCount + 1) % limit.everyCount != 0)
+			{
+				return false;
+			}
+
+			_suppressedCount = limit.everyCount - 1;
+
+			return true;
+		}
+
+		const i64 now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()
+		).count();
+
+		i64 nextTime = nextLogTime.load(std::memory_order_relaxed);
+
+		// Only one thread may log per interval
+		if (now < nextTime || !nextLogTime.compare_exchange_strong(nextTime, now + static_cast<i64>(limit.intervalNanoseconds), std::memory_order_relaxed))
+		{
+			return false;
+		}
+
+		u64 lastLogged = lastLoggedFailure.load(std::memory_order_relaxed);
+
+		// A thread may be preempted between counting its failure and winning the interval, so a later failure may already
+		// have been logged; `lastLoggedFailure` only moves forward, and nothing is reported as suppressed in that case
+		do
+		{
+			if (lastLogged != noneLogged && lastLogged >= failure)
+			{
+				_suppressedCount = 0;
+
+				return true;
+			}
+		}
+		while (!lastLoggedFailure.compare_exchange_weak(lastLogged, failure, std::memory_order_relaxed));
+
+		// `noneLogged` is the maximum value, so this wraps around to `failure` for the first logged failure
+		_suppressedCount = failure - lastLogged - 1;
+
+		return true;
+	}
+
+private:
+	/**
+	* The value of `lastLoggedFailure` before any failure has been logged
+	*/
+	static constexpr u64 noneLogged = ~static_cast<u64>(0);
+
+	/**
+	* How often the call site may log
+	*/
+	const LogRateLimit limit;
+
+	/**
+	* The number of times the call site has failed
+	*/
+	std::atomic<u64> failureCount = 0;
+
+	/**
+	* The failure which was last logged, used to count suppressed failures when the limit is an interval
+	*/
+	std::atomic<u64> lastLoggedFailure = noneLogged;
+
+	/**
+	* The earliest steady clock time, in nanoseconds, at which the call site may log again when the limit is an interval
+	*/
+	std::atomic<i64> nextLogTime = 0;
+};
+
+/**
+* This class is purely to hide the implementation from the user to make it clear not to interact with anything contained
+* within
+*/
+class RateLimitImplementation
+{
+public:
+	/**
+	* Logs _message at _level if it passes the runtime log level and _limiter allows it, then returns true
+	* Suppressed failures don't count towards the limit while the level is filtered out
+	*/
+	SLR_NOINLINE SLR_COLD static bool LogMessage(
+		LogRateLimiter& _limiter,
+		const std::string_view _message,
+		const LogLevel _level,
+		const std::source_location& _sourceLocation = std::source_location::current()
+	)
+	{
+		if (!ExceptionImplementation::IsLevelEnabled(_level))
+		{
+			return true;
+		}
+
+		u64 suppressedCount;
+
+		if (!_limiter.ShouldLog(suppressedCount))
+		{
+			return true;
+		}
+
+		if (suppressedCount == 0)
+		{
+			ExceptionImplementation::Log(_message, _level, _sourceLocation);
+
+			return true;
+		}
+
+		return ExceptionImplementation::LogFormatted(_level, _sourceLocation, "{} ({} similar messages suppressed)", _message, suppressedCount);
+	}
+};
+
+/**
+* Evaluates to a reference to a LogRateLimiter which is unique to the call site
+* _limit must be a constant expression, such as LogRateLimit::Interval(std::chrono::seconds(1))
+*/
+#define SLR_LOG_RATE_LIMITER(_limit) \
+	[]() -> LogRateLimiter& { static constinit LogRateLimiter limiter(_limit); return limiter; }()
+
+/**
+* Logs _message at the given level, subject to the call site's rate limit, and evaluates to true
+* If the level isn't compiled in, refer to SLR_LOG_LEVEL, this is just true
+*/
+#if SLR_LOG_LEVEL >= SLR_LOG_LEVEL_ERROR
+#define SLR_LOG_ERROR_LIMITED(_limit, _message) RateLimitImplementation::LogMessage(SLR_LOG_RATE_LIMITER(_limit), _message, LogLevel::ERROR)
+#else
+#define SLR_LOG_ERROR_LIMITED(_limit, _message) true
+#endif
+
+#if SLR_LOG_LEVEL >= SLR_LOG_LEVEL_WARNING
+#define SLR_LOG_WARNING_LIMITED(_limit, _message) RateLimitImplementation::LogMessage(SLR_LOG_RATE_LIMITER(_limit), _message, LogLevel::WARNING)
+#else
+#define SLR_LOG_WARNING_LIMITED(_limit, _message) true
+#endif
+
+#if SLR_LOG_LEVEL >= SLR_LOG_LEVEL_INFO
+#define SLR_LOG_INFO_LIMITED(_limit, _message) RateLimitImplementation::LogMessage(SLR_LOG_RATE_LIMITER(_limit), _message, LogLevel::INFO)
+#else
+#define SLR_LOG_INFO_LIMITED(_limit, _message) true
+#endif
+
+/**
+* Equivalent to SLR_ASSERT_ERROR(...), but the call site only logs as often as _limit allows
+* The body is still executed on every failure
+* Example usage:
+*     SLR_ASSERT_ERROR_LIMITED(allocation != nullptr, LogRateLimit::Interval(std::chrono::seconds(1)), "Failed to allocate")
+*     {
+*         return Status::FAIL;
+*     }
+*/
+#define SLR_ASSERT_ERROR_LIMITED(_condition, _limit, _message) \
+	if (static_cast<bool>(_condition) == false && SLR_LOG_ERROR_LIMITED(_limit, _message)) [[unlikely]]
+
+/**
+* Equivalent to SLR_ASSERT_WARNING(...), but the call site only logs as often as _limit allows
+*/
+#define SLR_ASSERT_WARNING_LIMITED(_condition, _limit, _message) \
+	if (static_cast<bool>(_condition) == false && SLR_LOG_WARNING_LIMITED(_limit, _message)) [[unlikely]]
+
+/**
+* Equivalent to SLR_ASSERT_INFO(...), but the call site only logs as often as _limit allows
+*/
+#define SLR_ASSERT_INFO_LIMITED(_condition, _limit, _message) \
+	if (static_cast<bool>(_condition) == false && SLR_LOG_INFO_LIMITED(_limit, _message)) [[unlikely]]
+
+/**
+* Equivalent to SLR_ERROR(...), but the call site only logs as often as _limit allows
+*/
+#define SLR_ERROR_LIMITED(_condition, _limit, _message) \
+	do { \
+		if (static_cast<bool>(_condition) == false) [[unlikely]] { \
+			static_cast<void>(SLR_LOG_ERROR_LIMITED(_limit, _message)); \
+		} \
+	} while (0)
+
+/**
+* Equivalent to SLR_WARNING(...), but the call site only logs as often as _limit allows
+*/
+#define SLR_WARNING_LIMITED(_condition, _limit, _message) \
+	do { \
+		if (static_cast<bool>(_condition) == false) [[unlikely]] { \
+			static_cast<void>(SLR_LOG_WARNING_LIMITED(_limit, _message)); \
+		} \
+	} while (0)
+
+/**
+* Equivalent to SLR_INFO(...), but the call site only logs as often as _limit allows
+*/
+#define SLR_INFO_LIMITED(_condition, _limit, _message) \
+	do { \
+		if (static_cast<bool>(_condition) == false) [[unlikely]] { \
+			static_cast<void>(SLR_LOG_INFO_LIMITED(_limit, _message)); \
+		} \
+	} while (0)
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_ERRORHANDLING_RATELIMIT
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+#ifndef SLR_INTERNAL_SIMD
+#define SLR_INTERNAL_SIMD
+
+/**
+* Detects which SIMD instruction sets are available to the compiler and includes their intrinsics
+* Each instruction set is only used when the compiler has been told it may use it (for example /arch:AVX2 or -mavx2), so no
+* runtime dispatch takes place; code using these must always provide a scalar fallback
+* Define SLR_SIMD_DISABLE to force the scalar fallbacks to be used
+*/
+
+#include "SlrLib/Internal/SimdDetect.hpp"
+
+#if defined(SLR_SIMD_AVX)
+#include <immintrin.h>
+#elif defined(SLR_SIMD_SSE41)
+#include <smmintrin.h>
+#elif defined(SLR_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
+#endif // ifndef SLR_INTERNAL_SIMD
\ No newline at end of file
@@ -0,0 +1,374 @@
+#pragma once
+#ifndef SLR_INTERNAL_SIMDBATCH
+#define SLR_INTERNAL_SIMDBATCH
+
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/Simd.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* Maps the widest available SIMD register onto consecutive values of _Type, for kernels which process whole arrays
+* Each register holds `width` values. Pair operations treat neighbouring values as the x and y components of a Vector2, so
+* arrays of Vector2 can be processed without first being deinterleaved. If there is no register for _Type on the target,
+* isEnabled is false and kernels must use their scalar code.
+* Loads and stores are unaligned because allocations made with MemAlloc(...) are only aligned to the size of `size`.
+*/
+template<typename _Type>
+struct SimdBatch
+{
+	static constexpr bool isEnabled = false;
+};
+
+#ifdef SLR_SIMD_AVX2
+
+/**
+* Eight floats in an AVX register
+*/
+template<>
+struct SimdBatch<float>
+{
+	static constexpr bool isEnabled = true;
+
+	using Register = __m256;
+
+	static constexpr size width = 8;
+
+	static inline Register Load(const float* _values) { return _mm256_loadu_ps(_values); }
+
+	static inline void Store(float* _values, const Register _value) { _mm256_storeu_ps(_values, _value); }
+
+	static inline Register Broadcast(const float _value) { return _mm256_set1_ps(_value); }
+
+	static inline Register Zero() { return _mm256_setzero_ps(); }
+
+	static inline Register Add(const Register _left, const Register _right) { return _mm256_add_ps(_left, _right); }
+
+	static inline Register Subtract(const Register _left, const Register _right) { return _mm256_sub_ps(_left, _right); }
+
+	static inline Register Multiply(const Register _left, const Register _right) { return _mm256_mul_ps(_left, _right); }
+
+	static inline Register Divide(const Register _left, const Register _right) { return _mm256_div_ps(_left, _right); }
+
+	static inline Register Sqrt(const Register _value) { return _mm256_sqrt_ps(_value); }
+
+	static inline Register Abs(const Register _value) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), _value); }
+
+	static inline Register Floor(const Register _value) { return _mm256_floor_ps(_value); }
+
+	/**
+	* Rounds each value to the nearest integer, with halfway values rounded to even
+	*/
+	static inline Register Round(const Register _value) { return _mm256_round_ps(_value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+	/**
+	* Returns the smaller value of each lane; if either value is NaN, the value from _right is returned
+	*/
+	static inline Register Minimum(const Register _left, const Register _right) { return _mm256_min_ps(_left, _right); }
+
+	/**
+	* Returns the larger value of each lane; if either value is NaN, the value from _right is returned
+	*/
+	static inline Register Maximum(const Register _left, const Register _right) { return _mm256_max_ps(_left, _right); }
+
+	/**
+	* Returns an estimate of 1 / sqrt(value), optionally refined by one Newton-Raphson step
+	* Refer to SqrtPrecision for the error bounds
+	*/
+	template<bool _IsRefined>
+	static inline Register ReciprocalSqrt(const Register _value)
+	{
+		const Register estimate = _mm256_rsqrt_ps(_value);
+
+		if constexpr (_IsRefined)
+		{
+			const Register halfValue = _mm256_mul_ps(_value, _mm256_set1_ps(0.5f));
+			const Register correction = _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(halfValue, _mm256_mul_ps(estimate, estimate)));
+
+			return _mm256_mul_ps(estimate, correction);
+		}
+		else
+		{
+			return estimate;
+		}
+	}
+
+	/**
+	* Returns _left * _right + _add
+	* This is a single rounding when FMA is available, so the result may differ from the scalar code in the last bit
+	*/
+	static inline Register MultiplyAdd(const Register _left, const Register _right, const Register _add)
+	{
+#ifdef SLR_SIMD_FMA
+		return _mm256_fmadd_ps(_left, _right, _add);
+#else
+		return _mm256_add_ps(_mm256_mul_ps(_left, _right), _add);
+#endif
+	}
+
+	/**
+	* Returns a mask of the values which are equal to zero
+	*/
+	static inline Register IsZero(const Register _value) { return _mm256_cmp_ps(_value, _mm256_setzero_ps(), _CMP_EQ_OQ); }
+
+	static inline Register Or(const Register _left, const Register _right) { return _mm256_or_ps(_left, _right); }
+
+	/**
+	* Returns _value with the values selected by _mask set to zero
+	*/
+	static inline Register ZeroWhere(const Register _mask, const Register _value) { return _mm256_andnot_ps(_mask, _value); }
+
+	/**
+	* Returns whether any value is selected by _mask
+	*/
+	static inline bool IsAny(const Register _mask) { return _mm256_movemask_ps(_mask) != 0; }
+
+	/**
+	* Returns a mask of the values which are equal
+	*/
+	static inline Register IsEqual(const Register _left, const Register _right) { return _mm256_cmp_ps(_left, _right, _CMP_EQ_OQ); }
+
+	/**
+	* Returns a mask of the values of _left which are less than those of _right
+	*/
+	static inline Register IsLess(const Register _left, const Register _right) { return _mm256_cmp_ps(_left, _right, _CMP_LT_OQ); }
+
+	/**
+	* Returns a mask of the values of _left which are less than or equal to those of _right
+	*/
+	static inline Register IsLessOrEqual(const Register _left, const Register _right) { return _mm256_cmp_ps(_left, _right, _CMP_LE_OQ); }
+
+	/**
+	* Returns _ifTrue for the values selected by _mask, and _ifFalse for the others
+	*/
+	static inline Register Select(const Register _mask, const Register _ifTrue, const Register _ifFalse)
+	{
+		return _mm256_blendv_ps(_ifFalse, _ifTrue, _mask);
+	}
+
+	/**
+	* Returns _value with the values selected by _mask negated
+	*/
+	static inline Register NegateWhere(const Register _mask, const Register _value)
+	{
+		return _mm256_xor_ps(_value, _mm256_and_ps(_mask, _mm256_set1_ps(-0.0f)));
+	}
+
+	/**
+	* Returns the bitwise and of _left and _right, which combines masks
+	*/
+	static inline Register And(const Register _left, const Register _right) { return _mm256_and_ps(_left, _right); }
+
+	/**
+	* Returns the lanes selected by _mask as bits, where the first lane is the lowest bit
+	*/
+	static inline u32 GetMask(const Register _mask) { return static_cast<u32>(_mm256_movemask_ps(_mask)); }
+
+	/**
+	* Swaps each value with its neighbour, turning (x, y) pairs into (y, x) pairs
+	*/
+	static inline Register SwapPairs(const Register _value) { return _mm256_permute_ps(_value, _MM_SHUFFLE(2, 3, 0, 1)); }
+
+	/**
+	* Returns a register of (_x, _y) pairs
+	*/
+	static inline Register BroadcastPair(const float _x, const float _y) { return _mm256_setr_ps(_x, _y, _x, _y, _x, _y, _x, _y); }
+
+	/**
+	* Copies the x component of each pair over its y component
+	*/
+	static inline Register DuplicateX(const Register _value) { return _mm256_moveldup_ps(_value); }
+
+	/**
+	* Copies the y component of each pair over its x component
+	*/
+	static inline Register DuplicateY(const Register _value) { return _mm256_movehdup_ps(_value); }
+
+	/**
+	* Returns x + y of each pair in _first followed by x + y of each pair in _second
+	*/
+	static inline Register AddPairs(const Register _first, const Register _second)
+	{
+		// hadd interleaves the pairs of each input per 128 bit half, so put the halves back in order
+		return Reorder(_mm256_hadd_ps(_first, _second));
+	}
+
+	/**
+	* Returns x - y of each pair in _first followed by x - y of each pair in _second
+	*/
+	static inline Register SubtractPairs(const Register _first, const Register _second)
+	{
+		return Reorder(_mm256_hsub_ps(_first, _second));
+	}
+
+private:
+	static inline Register Reorder(const Register _value)
+	{
+		return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_value), _MM_SHUFFLE(3, 1, 2, 0)));
+	}
+};
+
+/**
+* Four doubles in an AVX register
+*/
+template<>
+struct SimdBatch<double>
+{
+	static constexpr bool isEnabled = true;
+
+	using Register = __m256d;
+
+	static constexpr size width = 4;
+
+	static inline Register Load(const double* _values) { return _mm256_loadu_pd(_values); }
+
+	static inline void Store(double* _values, const Register _value) { _mm256_storeu_pd(_values, _value); }
+
+	static inline Register Broadcast(const double _value) { return _mm256_set1_pd(_value); }
+
+	static inline Register Zero() { return _mm256_setzero_pd(); }
+
+	static inline Register Add(const Register _left, const Register _right) { return _mm256_add_pd(_left, _right); }
+
+	static inline Register Subtract(const Register _left, const Register _right) { return _mm256_sub_pd(_left, _right); }
+
+	static inline Register Multiply(const Register _left, const Register _right) { return _mm256_mul_pd(_left, _right); }
+
+	static inline Register Divide(const Register _left, const Register _right) { return _mm256_div_pd(_left, _right); }
+
+	static inline Register Sqrt(const Register _value) { return _mm256_sqrt_pd(_value); }
+
+	static inline Register Abs(const Register _value) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), _value); }
+
+	static inline Register Floor(const Register _value) { return _mm256_floor_pd(_value); }
+
+	/**
+	* Rounds each value to the nearest integer, with halfway values rounded to even
+	*/
+	static inline Register Round(const Register _value) { return _mm256_round_pd(_value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+	/**
+	* Returns the smaller value of each lane; if either value is NaN, the value from _right is returned
+	*/
+	static inline Register Minimum(const Register _left, const Register _right) { return _mm256_min_pd(_left, _right); }
+
+	/**
+	* Returns the larger value of each lane; if either value is NaN, the value from _right is returned
+	*/
+	static inline Register Maximum(const Register _left, const Register _right) { return _mm256_max_pd(_left, _right); }
+
+	/**
+	* Returns _left * _right + _add
+	* This is a single rounding when FMA is available, so the result may differ from the scalar code in the last bit
+	*/
+	static inline Register MultiplyAdd(const Register _left, const Register _right, const Register _add)
+	{
+#ifdef SLR_SIMD_FMA
+		return _mm256_fmadd_pd(_left, _right, _add);
+#else
+		return _mm256_add_pd(_mm256_mul_pd(_left, _right), _add);
+#endif
+	}
+
+	/**
+	* Returns a mask of the values which are equal to zero
+	*/
+	static inline Register IsZero(const Register _value) { return _mm256_cmp_pd(_value, _mm256_setzero_pd(), _CMP_EQ_OQ); }
+
+	static inline Register Or(const Register _left, const Register _right) { return _mm256_or_pd(_left, _right); }
+
+	/**
+	* Returns _value with the values selected by _mask set to zero
+	*/
+	static inline Register ZeroWhere(const Register _mask, const Register _value) { return _mm256_andnot_pd(_mask, _value); }
+
+	/**
+	* Returns whether any value is selected by _mask
+	*/
+	static inline bool IsAny(const Register _mask) { return _mm256_movemask_pd(_mask) != 0; }
+
+	/**
+	* Returns a mask of the values which are equal
+	*/
+	static inline Register IsEqual(const Register _left, const Register _right) { return _mm256_cmp_pd(_left, _right, _CMP_EQ_OQ); }
+
+	/**
+	* Returns a mask of the values of _left which are less than those of _right
+	*/
+	static inline Register IsLess(const Register _left, const Register _right) { return _mm256_cmp_pd(_left, _right, _CMP_LT_OQ); }
+
+	/**
+	* Returns a mask of the values of _left which are less than or equal to those of _right
+	*/
+	static inline Register IsLessOrEqual(const Register _left, const Register _right) { return _mm256_cmp_pd(_left, _right, _CMP_LE_OQ); }
+
+	/**
+	* Returns _ifTrue for the values selected by _mask, and _ifFalse for the others
+	*/
+	static inline Register Select(const Register _mask, const Register _ifTrue, const Register _ifFalse)
+	{
+		return _mm256_blendv_pd(_ifFalse, _ifTrue, _mask);
+	}
+
+	/**
+	* Returns _value with the values selected by _mask negated
+	*/
+	static inline Register NegateWhere(const Register _mask, const Register _value)
+	{
+		return _mm256_xor_pd(_value, _mm256_and_pd(_mask, _mm256_set1_pd(-0.0)));
+	}
+
+	/**
+	* Returns the bitwise and of _left and _right, which combines masks
+	*/
+	static inline Register And(const Register _left, const Register _right) { return _mm256_and_pd(_left, _right); }
+
+	/**
+	* Returns the lanes selected by _mask as bits, where the first lane is the lowest bit
+	*/
+	static inline u32 GetMask(const Register _mask) { return static_cast<u32>(_mm256_movemask_pd(_mask)); }
+
+	/**
+	* Swaps each value with its neighbour, turning (x, y) pairs into (y, x) pairs
+	*/
+	static inline Register SwapPairs(const Register _value) { return _mm256_permute_pd(_value, 0b0101); }
+
+	/**
+	* Returns a register of (_x, _y) pairs
+	*/
+	static inline Register BroadcastPair(const double _x, const double _y) { return _mm256_setr_pd(_x, _y, _x, _y); }
+
+	/**
+	* Copies the x component of each pair over its y component
+	*/
+	static inline Register DuplicateX(const Register _value) { return _mm256_movedup_pd(_value); }
+
+	/**
+	* Copies the y component of each pair over its x component
+	*/
+	static inline Register DuplicateY(const Register _value) { return _mm256_permute_pd(_value, 0b1111); }
+
+	/**
+	* Returns x + y of each pair in _first followed by x + y of each pair in _second
+	*/
+	static inline Register AddPairs(const Register _first, const Register _second)
+	{
+		// hadd interleaves the pairs of each input, so put them back in order
+		return _mm256_permute4x64_pd(_mm256_hadd_pd(_first, _second), _MM_SHUFFLE(3, 1, 2, 0));
+	}
+
+	/**
+	* Returns x - y of each pair in _first followed by x - y of each pair in _second
+	*/
+	static inline Register SubtractPairs(const Register _first, const Register _second)
+	{
+		return _mm256_permute4x64_pd(_mm256_hsub_pd(_first, _second), _MM_SHUFFLE(3, 1, 2, 0));
+	}
+};
+
+#endif // ifdef SLR_SIMD_AVX2
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_INTERNAL_SIMDBATCH
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+#ifndef SLR_INTERNAL_SIMDDETECT
+#define SLR_INTERNAL_SIMDDETECT
+
+/**
+* Detects which SIMD instruction sets are available to the compiler, without including any intrinsics
+* Include Simd.hpp to use the instruction sets; this is for headers which only need to know whether they're available, or
+* which include the small intrinsic headers they need themselves
+* Define SLR_SIMD_DISABLE to force the scalar fallbacks to be used
+*/
+
+#ifndef SLR_SIMD_DISABLE
+
+// SSE2 is always available on x64; MSVC reports it for x86 through _M_IX86_FP
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SLR_SIMD_SSE2
+#endif
+
+#if defined(__SSE4_1__) || defined(__AVX__)
+#define SLR_SIMD_SSE41
+#endif
+
+#if defined(__AVX__)
+#define SLR_SIMD_AVX
+#endif
+
+#if defined(__AVX2__)
+#define SLR_SIMD_AVX2
+#endif
+
+// MSVC does not define __FMA__ or __F16C__, but every processor supporting AVX2 supports both
+#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define SLR_SIMD_FMA
+#endif
+
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define SLR_SIMD_F16C
+#endif
+
+#endif // ifndef SLR_SIMD_DISABLE
+
+#endif // ifndef SLR_INTERNAL_SIMDDETECT
\ No newline at end of file
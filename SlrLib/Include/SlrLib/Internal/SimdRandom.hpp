@@ -0,0 +1,91 @@
+#pragma once
+#ifndef SLR_INTERNAL_SIMDRANDOM
+#define SLR_INTERNAL_SIMDRANDOM
+
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/Simd.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* Runs four xoshiro256** generators side by side, one within each 64-bit lane of an AVX2 register
+* Word i of the state of every lane is held in register i. If AVX2 is not available, isEnabled is false and the generators
+* must be stepped one at a time.
+*/
+struct SimdXoshiro256StarStar
+{
+#ifdef SLR_SIMD_AVX2
+	static constexpr bool isEnabled = true;
+
+	using Register = __m256i;
+
+	static inline Register Load(const u64* _values) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_values)); }
+
+	static inline void Store(u64* _values, const Register _value)
+	{
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(_values), _value);
+	}
+
+	/**
+	* Steps every lane, returning the output of each
+	* AVX2 has no 64-bit multiplication, so the multiplications by 5 and 9 are made from shifts and additions
+	*/
+	static inline Register Next(Register& _s0, Register& _s1, Register& _s2, Register& _s3)
+	{
+		const Register timesFive = _mm256_add_epi64(_mm256_slli_epi64(_s1, 2), _s1);
+		const Register rotated = _mm256_or_si256(_mm256_slli_epi64(timesFive, 7), _mm256_srli_epi64(timesFive, 57));
+		const Register result = _mm256_add_epi64(_mm256_slli_epi64(rotated, 3), rotated);
+
+		const Register shifted = _mm256_slli_epi64(_s1, 17);
+
+		_s2 = _mm256_xor_si256(_s2, _s0);
+		_s3 = _mm256_xor_si256(_s3, _s1);
+		_s1 = _mm256_xor_si256(_s1, _s2);
+		_s0 = _mm256_xor_si256(_s0, _s3);
+		_s2 = _mm256_xor_si256(_s2, shifted);
+		_s3 = _mm256_or_si256(_mm256_slli_epi64(_s3, 45), _mm256_srli_epi64(_s3, 19));
+
+		return result;
+	}
+
+	/**
+	* Stores the upper 32 bits of each lane as four consecutive values
+	*/
+	static inline void Store(u32* _values, const Register _value)
+	{
+		// Gather the odd 32-bit elements, which hold the upper halves, into the lower 128 bits
+		const Register upper = _mm256_permutevar8x32_epi32(_value, _mm256_setr_epi32(1, 3, 5, 7, 0, 0, 0, 0));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(_values), _mm256_castsi256_si128(upper));
+	}
+
+	/**
+	* Stores the upper 24 bits of each lane as four consecutive floats in [0, 1)
+	*/
+	static inline void Store(float* _values, const Register _value)
+	{
+		const Register bits = _mm256_permutevar8x32_epi32(_mm256_srli_epi64(_value, 40), _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0));
+		const __m128 floats = _mm_cvtepi32_ps(_mm256_castsi256_si128(bits));
+
+		_mm_storeu_ps(_values, _mm_mul_ps(floats, _mm_set1_ps(0x1.0p-24f)));
+	}
+
+	/**
+	* Stores the upper 52 bits of each lane as four consecutive doubles in [0, 1)
+	* The bits form the mantissa of a double in [1, 2), from which one is subtracted
+	*/
+	static inline void Store(double* _values, const Register _value)
+	{
+		const Register bits = _mm256_or_si256(_mm256_srli_epi64(_value, 12), _mm256_set1_epi64x(0x3FF0000000000000));
+
+		_mm256_storeu_pd(_values, _mm256_sub_pd(_mm256_castsi256_pd(bits), _mm256_set1_pd(1.0)));
+	}
+#else
+	static constexpr bool isEnabled = false;
+#endif
+};
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_INTERNAL_SIMDRANDOM
\ No newline at end of file
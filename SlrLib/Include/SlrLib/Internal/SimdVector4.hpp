@@ -0,0 +1,201 @@
+#pragma once
+#ifndef SLR_INTERNAL_SIMDVECTOR4
+#define SLR_INTERNAL_SIMDVECTOR4
+
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/Simd.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* Maps four consecutive components of _Type onto a single SIMD register
+* This is used by Vector4, and by Vector3 with a padded layout, so that component-wise arithmetic compiles to a single
+* instruction. If there is no register for _Type on the target, isEnabled is false and the vector uses its scalar code.
+* Loads and stores are unaligned because allocations made with MemAlloc(...) are only aligned to the size of `size`; on any
+* processor supporting these instruction sets, unaligned loads of aligned data are as fast as aligned loads.
+*/
+template<typename _Type>
+struct SimdVector4
+{
+	static constexpr bool isEnabled = false;
+
+	static constexpr bool hasCross = false;
+};
+
+#ifdef SLR_SIMD_SSE2
+
+/**
+* Four floats in an SSE register
+*/
+template<>
+struct SimdVector4<float>
+{
+	static constexpr bool isEnabled = true;
+
+	using Register = __m128;
+
+	static inline Register Load(const float* _components) { return _mm_loadu_ps(_components); }
+
+	static inline void Store(float* _components, const Register _value) { _mm_storeu_ps(_components, _value); }
+
+	static inline Register Broadcast(const float _value) { return _mm_set1_ps(_value); }
+
+	static inline Register Add(const Register _left, const Register _right) { return _mm_add_ps(_left, _right); }
+
+	static inline Register Subtract(const Register _left, const Register _right) { return _mm_sub_ps(_left, _right); }
+
+	static inline Register Multiply(const Register _left, const Register _right) { return _mm_mul_ps(_left, _right); }
+
+	static inline Register Divide(const Register _left, const Register _right) { return _mm_div_ps(_left, _right); }
+
+	/**
+	* Divides the first three components
+	* The fourth component of _right is replaced with 1, so padding never divides zero by zero, which would raise an invalid
+	* operation and store NaN; the fourth component of the result is that of _left
+	*/
+	static inline Register Divide3(const Register _left, const Register _right)
+	{
+		const Register mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+		const Register one = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+
+		return _mm_div_ps(_left, _mm_or_ps(_mm_and_ps(_right, mask), one));
+	}
+
+	/**
+	* Flips the sign bit of each component
+	*/
+	static inline Register Negate(const Register _value) { return _mm_xor_ps(_value, _mm_set1_ps(-0.0f)); }
+
+	/**
+	* Returns the sum of all four components of the component-wise product
+	*/
+	static inline float Dot4(const Register _left, const Register _right)
+	{
+		return HorizontalSum(_mm_mul_ps(_left, _right));
+	}
+
+	/**
+	* Returns the sum of the first three components of the component-wise product
+	* The fourth component is masked out so that padding never affects the result, even if it's NaN
+	*/
+	static inline float Dot3(const Register _left, const Register _right)
+	{
+		const Register mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+
+		return HorizontalSum(_mm_and_ps(_mm_mul_ps(_left, _right), mask));
+	}
+
+	/**
+	* Returns the cross product of the first three components
+	* The fourth component of the result is the fourth component of _left multiplied by _right, minus itself
+	*/
+	static inline Register Cross3(const Register _left, const Register _right)
+	{
+		// left * right.yzx - left.yzx * right, which is the cross product in zxy order
+		const Register leftYZX = _mm_shuffle_ps(_left, _left, _MM_SHUFFLE(3, 0, 2, 1));
+		const Register rightYZX = _mm_shuffle_ps(_right, _right, _MM_SHUFFLE(3, 0, 2, 1));
+		const Register crossZXY = _mm_sub_ps(_mm_mul_ps(_left, rightYZX), _mm_mul_ps(leftYZX, _right));
+
+		// Rotate back into xyz order
+		return _mm_shuffle_ps(crossZXY, crossZXY, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+
+	static constexpr bool hasCross = true;
+
+private:
+	/**
+	* Adds the four components of a register together
+	*/
+	static inline float HorizontalSum(const Register _value)
+	{
+		const Register swapped = _mm_shuffle_ps(_value, _value, _MM_SHUFFLE(2, 3, 0, 1));
+		const Register pairs = _mm_add_ps(_value, swapped);
+		const Register high = _mm_movehl_ps(swapped, pairs);
+
+		return _mm_cvtss_f32(_mm_add_ss(pairs, high));
+	}
+};
+
+#endif // ifdef SLR_SIMD_SSE2
+
+#ifdef SLR_SIMD_AVX
+
+/**
+* Four doubles in an AVX register
+*/
+template<>
+struct SimdVector4<double>
+{
+	static constexpr bool isEnabled = true;
+
+	using Register = __m256d;
+
+	static inline Register Load(const double* _components) { return _mm256_loadu_pd(_components); }
+
+	static inline void Store(double* _components, const Register _value) { _mm256_storeu_pd(_components, _value); }
+
+	static inline Register Broadcast(const double _value) { return _mm256_set1_pd(_value); }
+
+	static inline Register Add(const Register _left, const Register _right) { return _mm256_add_pd(_left, _right); }
+
+	static inline Register Subtract(const Register _left, const Register _right) { return _mm256_sub_pd(_left, _right); }
+
+	static inline Register Multiply(const Register _left, const Register _right) { return _mm256_mul_pd(_left, _right); }
+
+	static inline Register Divide(const Register _left, const Register _right) { return _mm256_div_pd(_left, _right); }
+
+	/**
+	* Divides the first three components
+	* The fourth component of _right is replaced with 1, so padding never divides zero by zero, which would raise an invalid
+	* operation and store NaN; the fourth component of the result is that of _left
+	*/
+	static inline Register Divide3(const Register _left, const Register _right)
+	{
+		return _mm256_div_pd(_left, _mm256_blend_pd(_right, _mm256_set1_pd(1.0), 0b1000));
+	}
+
+	/**
+	* Flips the sign bit of each component
+	*/
+	static inline Register Negate(const Register _value) { return _mm256_xor_pd(_value, _mm256_set1_pd(-0.0)); }
+
+	/**
+	* Returns the sum of all four components of the component-wise product
+	*/
+	static inline double Dot4(const Register _left, const Register _right)
+	{
+		return HorizontalSum(_mm256_mul_pd(_left, _right));
+	}
+
+	/**
+	* Returns the sum of the first three components of the component-wise product
+	* The fourth component is masked out so that padding never affects the result, even if it's NaN
+	*/
+	static inline double Dot3(const Register _left, const Register _right)
+	{
+		const Register mask = _mm256_castsi256_pd(_mm256_set_epi64x(0, -1, -1, -1));
+
+		return HorizontalSum(_mm256_and_pd(_mm256_mul_pd(_left, _right), mask));
+	}
+
+	// Shuffling across the two halves of the register requires AVX2, so the cross product is left to the scalar code
+	static constexpr bool hasCross = false;
+
+private:
+	/**
+	* Adds the four components of a register together
+	*/
+	static inline double HorizontalSum(const Register _value)
+	{
+		const __m128d pairs = _mm_add_pd(_mm256_castpd256_pd128(_value), _mm256_extractf128_pd(_value, 1));
+
+		return _mm_cvtsd_f64(_mm_add_sd(pairs, _mm_unpackhi_pd(pairs, pairs)));
+	}
+};
+
+#endif // ifdef SLR_SIMD_AVX
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_INTERNAL_SIMDVECTOR4
\ No newline at end of file
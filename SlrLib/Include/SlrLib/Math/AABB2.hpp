@@ -0,0 +1,438 @@
+#pragma once
+#ifndef SLR_MATH_AABB2
+#define SLR_MATH_AABB2
+
+#include <bit>
+#include <span>
+#include <type_traits>
+
+#include "SlrLib/Containers/DynamicArray.hpp"
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/SimdBatch.hpp"
+#include "SlrLib/Math/Functions.hpp"
+#include "SlrLib/Math/Vector2.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* An axis-aligned bounding box
+* The box covers minimum to maximum inclusively, so boxes which only touch are considered to intersect. A box is valid
+* while neither component of its minimum exceeds that of its maximum; a box with zero width or height is valid.
+*/
+template<typename _Type>
+struct AABB2
+{
+	static_assert(std::is_arithmetic<_Type>::value, "Type of bounding box template must be numeric");
+
+	/**
+	* The corner with the lowest x and y components
+	*/
+	Vector2<_Type> minimum;
+
+	/**
+	* The corner with the highest x and y components
+	*/
+	Vector2<_Type> maximum;
+
+	/**
+	* Default constructor
+	* Default initializes both corners to 0
+	*/
+	constexpr AABB2() = default;
+
+	/**
+	* Constructor
+	* Takes the two corners of the box
+	*/
+	constexpr AABB2(const Vector2<_Type>& _minimum, const Vector2<_Type>& _maximum) :
+		minimum(_minimum),
+		maximum(_maximum)
+	{}
+
+	/**
+	* Equal to operator
+	* Returns true if both corners are equal
+	*/
+	constexpr bool operator==(const AABB2& _rhs) const { return minimum == _rhs.minimum && maximum == _rhs.maximum; }
+
+	/**
+	* Not equal to operator
+	* Returns true if either corner is not equal
+	*/
+	constexpr bool operator!=(const AABB2& _rhs) const { return !(*this == _rhs); }
+
+	/**
+	* Returns whether neither component of the minimum exceeds that of the maximum
+	*/
+	constexpr Status IsValid(SLR_RETURN(bool) _result) const
+	{
+		_result = minimum.x <= maximum.x && minimum.y <= maximum.y;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the smallest box which contains both boxes
+	*/
+	constexpr Status Union(SLR_RETURN(AABB2) _result, const AABB2& _other) const
+	{
+		Min(_result.minimum.x, minimum.x, _other.minimum.x);
+		Min(_result.minimum.y, minimum.y, _other.minimum.y);
+		Max(_result.maximum.x, maximum.x, _other.maximum.x);
+		Max(_result.maximum.y, maximum.y, _other.maximum.y);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns whether the boxes overlap or touch
+	*/
+	constexpr Status Intersects(SLR_RETURN(bool) _result, const AABB2& _other) const
+	{
+		_result =
+			minimum.x <= _other.maximum.x && maximum.x >= _other.minimum.x &&
+			minimum.y <= _other.maximum.y && maximum.y >= _other.minimum.y;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns whether a point lies within the box, including its boundary
+	*/
+	constexpr Status Contains(SLR_RETURN(bool) _result, const Vector2<_Type>& _point) const
+	{
+		_result = _point.x >= minimum.x && _point.x <= maximum.x && _point.y >= minimum.y && _point.y <= maximum.y;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns whether another box lies entirely within the box
+	*/
+	constexpr Status Contains(SLR_RETURN(bool) _result, const AABB2& _other) const
+	{
+		_result =
+			_other.minimum.x >= minimum.x && _other.maximum.x <= maximum.x &&
+			_other.minimum.y >= minimum.y && _other.maximum.y <= maximum.y;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the box grown by _margin on every side
+	* A negative margin shrinks the box; fails if this would make the box invalid
+	*/
+	constexpr Status Expand(SLR_RETURN(AABB2) _result, const _Type _margin) const
+	{
+		const AABB2 expanded(
+			Vector2<_Type>(minimum.x - _margin, minimum.y - _margin),
+			Vector2<_Type>(maximum.x + _margin, maximum.y + _margin)
+		);
+
+		bool isValid;
+		expanded.IsValid(isValid);
+
+		SLR_ASSERT_ERROR(isValid, "Margin shrinks the box past zero size")
+		{
+			return Status::FAIL;
+		}
+
+		_result = expanded;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the smallest box which contains both the box and a point
+	*/
+	constexpr Status Enclose(SLR_RETURN(AABB2) _result, const Vector2<_Type>& _point) const
+	{
+		return Union(_result, AABB2(_point, _point));
+	}
+
+	/**
+	* Returns the center of the box
+	*/
+	constexpr Status GetCenter(SLR_RETURN(Vector2<_Type>) _result) const
+	{
+		_result = Vector2<_Type>((minimum.x + maximum.x) / 2, (minimum.y + maximum.y) / 2);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the width and height of the box
+	*/
+	constexpr Status GetSize(SLR_RETURN(Vector2<_Type>) _result) const
+	{
+		_result = Vector2<_Type>(maximum.x - minimum.x, maximum.y - minimum.y);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a box centered on _center which extends _halfSize in each direction
+	*/
+	static constexpr Status CreateFromCenter(
+		SLR_RETURN(AABB2) _result,
+		const Vector2<_Type>& _center,
+		const Vector2<_Type>& _halfSize
+	)
+	{
+		SLR_ASSERT_ERROR(_halfSize.x >= 0 && _halfSize.y >= 0, "Half size must not be negative")
+		{
+			return Status::FAIL;
+		}
+
+		_result = AABB2(
+			Vector2<_Type>(_center.x - _halfSize.x, _center.y - _halfSize.y),
+			Vector2<_Type>(_center.x + _halfSize.x, _center.y + _halfSize.y)
+		);
+
+		return Status::SUCCESS;
+	}
+};
+
+/**
+* A view of an array of boxes stored as structure of arrays
+* Each component of the corners is held in a separate array, and all four arrays are expected to be the same size. The
+* view does not own the arrays.
+* An AABB2SoA<const _Type> can be created from an AABB2SoA<_Type> for read-only access.
+*/
+template<typename _Type>
+struct AABB2SoA
+{
+	static_assert(std::is_arithmetic<std::remove_const_t<_Type>>::value, "Type of bounding box template must be numeric");
+
+	std::span<_Type> minimumX;
+	std::span<_Type> minimumY;
+	std::span<_Type> maximumX;
+	std::span<_Type> maximumY;
+
+	/**
+	* Default constructor
+	* The view is empty
+	*/
+	constexpr AABB2SoA() = default;
+
+	/**
+	* Constructor
+	* Takes the arrays of each component of the corners
+	*/
+	constexpr AABB2SoA(
+		const std::span<_Type> _minimumX,
+		const std::span<_Type> _minimumY,
+		const std::span<_Type> _maximumX,
+		const std::span<_Type> _maximumY
+	) :
+		minimumX(_minimumX),
+		minimumY(_minimumY),
+		maximumX(_maximumX),
+		maximumY(_maximumY)
+	{}
+
+	/**
+	* Converting constructor
+	* Allows a view of mutable components to be passed where a view of const components is expected
+	*/
+	template<typename _Other>
+	constexpr AABB2SoA(const AABB2SoA<_Other>& _other) :
+		minimumX(_other.minimumX),
+		minimumY(_other.minimumY),
+		maximumX(_other.maximumX),
+		maximumY(_other.maximumY)
+	{}
+
+	/**
+	* Returns the number of boxes within the view
+	*/
+	constexpr size GetSize() const { return minimumX.size(); }
+
+	/**
+	* Returns whether every array is the same size
+	*/
+	constexpr bool IsValid() const
+	{
+		return
+			minimumX.size() == minimumY.size() &&
+			minimumX.size() == maximumX.size() &&
+			minimumX.size() == maximumY.size();
+	}
+};
+
+/**
+* A pair of intersecting boxes, identified by their indices
+*/
+struct AABB2Pair
+{
+	u32 first;
+	u32 second;
+};
+
+/**
+* Shared implementation of the bounding box kernels
+* This class is purely to hide the implementation from the user to make it clear not to interact with anything contained
+* within it
+*/
+class AABB2Implementation
+{
+public:
+	/**
+	* Calls _output(i) for every index i from _first up to, but excluding, _last for which box i of _boxes intersects _box
+	*/
+	template<typename _Type, typename _Output>
+	static inline void ForEachIntersecting(
+		const AABB2SoA<const _Type>& _boxes,
+		const AABB2<_Type>& _box,
+		const size _first,
+		const size _last,
+		_Output&& _output
+	)
+	{
+		size i = _first;
+
+		if constexpr (SimdBatch<_Type>::isEnabled)
+		{
+			using Simd = SimdBatch<_Type>;
+
+			const typename Simd::Register minimumX = Simd::Broadcast(_box.minimum.x);
+			const typename Simd::Register minimumY = Simd::Broadcast(_box.minimum.y);
+			const typename Simd::Register maximumX = Simd::Broadcast(_box.maximum.x);
+			const typename Simd::Register maximumY = Simd::Broadcast(_box.maximum.y);
+
+			for (; i + Simd::width <= _last; i += Simd::width)
+			{
+				const typename Simd::Register x = Simd::And(
+					Simd::IsLessOrEqual(Simd::Load(_boxes.minimumX.data() + i), maximumX),
+					Simd::IsLessOrEqual(minimumX, Simd::Load(_boxes.maximumX.data() + i))
+				);
+
+				const typename Simd::Register y = Simd::And(
+					Simd::IsLessOrEqual(Simd::Load(_boxes.minimumY.data() + i), maximumY),
+					Simd::IsLessOrEqual(minimumY, Simd::Load(_boxes.maximumY.data() + i))
+				);
+
+				// Visit the set lanes from lowest to highest, so the indices are produced in ascending order
+				for (u32 mask = Simd::GetMask(Simd::And(x, y)); mask != 0; mask &= mask - 1)
+				{
+					_output(i + std::countr_zero(mask));
+				}
+			}
+		}
+
+		for (; i < _last; ++i)
+		{
+			if (
+				_boxes.minimumX[i] <= _box.maximum.x && _boxes.maximumX[i] >= _box.minimum.x &&
+				_boxes.minimumY[i] <= _box.maximum.y && _boxes.maximumY[i] >= _box.minimum.y
+			)
+			{
+				_output(i);
+			}
+		}
+	}
+};
+
+/**
+* Tests every box of _boxes against _box, writing the indices of those which intersect to the start of _indices in
+* ascending order
+* _count is set to the number of intersecting boxes. _indices must be able to hold every box of _boxes.
+*/
+template<typename _Type>
+Status BatchIntersects(
+	SLR_RETURN(size) _count,
+	const std::span<u32> _indices,
+	const AABB2SoA<const std::type_identity_t<_Type>> _boxes,
+	const AABB2<_Type>& _box
+)
+{
+	SLR_ASSERT_ERROR(_boxes.IsValid(), "Component arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(_indices.size() >= _boxes.GetSize(), "Index array must be able to hold every box")
+	{
+		return Status::FAIL;
+	}
+
+	size count = 0;
+
+	AABB2Implementation::ForEachIntersecting<_Type>(_boxes, _box, 0, _boxes.GetSize(), [&](const size _index)
+	{
+		_indices[count++] = static_cast<u32>(_index);
+	});
+
+	_count = count;
+
+	return Status::SUCCESS;
+}
+
+/**
+* Tests every box of _first against every box of _second
+* _pairs is replaced with a pair for each intersection, where AABB2Pair::first indexes _first and AABB2Pair::second
+* indexes _second, ordered by the index into _first and then by the index into _second
+*/
+template<typename _Type>
+Status BatchIntersects(
+	SLR_RETURN(DynamicArray<AABB2Pair>) _pairs,
+	const AABB2SoA<const _Type> _first,
+	const AABB2SoA<const std::type_identity_t<_Type>> _second
+)
+{
+	SLR_ASSERT_ERROR(_first.IsValid() && _second.IsValid(), "Component arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	_pairs.RemoveAll();
+
+	Status status = Status::SUCCESS;
+
+	for (size i = 0; i < _first.GetSize(); ++i)
+	{
+		const AABB2<_Type> box(
+			Vector2<_Type>(_first.minimumX[i], _first.minimumY[i]),
+			Vector2<_Type>(_first.maximumX[i], _first.maximumY[i])
+		);
+
+		AABB2Implementation::ForEachIntersecting<_Type>(_second, box, 0, _second.GetSize(), [&](const size _index)
+		{
+			if (_pairs.Add(AABB2Pair{ static_cast<u32>(i), static_cast<u32>(_index) }) != Status::SUCCESS)
+			{
+				status = Status::FAIL;
+			}
+		});
+	}
+
+	SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not add every pair")
+	{
+		return Status::FAIL;
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Tests every box of _first against every box of _second
+* This overload allows _first to be a view of mutable components, as the template type can't be deduced through the
+* conversion to a view of const components
+*/
+template<typename _Type>
+Status BatchIntersects(
+	SLR_RETURN(DynamicArray<AABB2Pair>) _pairs,
+	const AABB2SoA<_Type> _first,
+	const AABB2SoA<const std::type_identity_t<_Type>> _second
+)
+{
+	return BatchIntersects<_Type>(_pairs, AABB2SoA<const _Type>(_first), _second);
+}
+
+using AABB2f = AABB2<float>;
+using AABB2d = AABB2<double>;
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MATH_AABB2
\ No newline at end of file
@@ -0,0 +1,126 @@
+#pragma once
+#ifndef SLR_MATH_BATCHSQRT
+#define SLR_MATH_BATCHSQRT
+
+#include <cmath>
+#include <span>
+#include <type_traits>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/SimdBatch.hpp"
+#include "SlrLib/Math/Functions.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* Calculates RSqrt(...) of each value of _values
+* The values are not checked; the results for values which aren't positive are unspecified
+* _result may be the same array as _values
+*/
+template<SqrtPrecision _Precision = SqrtPrecision::MEDIUM, typename _Type>
+Status BatchRSqrt(const std::span<_Type> _result, const std::span<const std::type_identity_t<_Type>> _values)
+{
+	static_assert(std::is_floating_point<_Type>::value, "Type of reciprocal square root must be floating point");
+
+	SLR_ASSERT_ERROR(_values.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		const typename Simd::Register one = Simd::Broadcast(1);
+
+		for (; i + Simd::width <= _result.size(); i += Simd::width)
+		{
+			const typename Simd::Register values = Simd::Load(_values.data() + i);
+
+			if constexpr (SqrtImplementation::isApproximate<_Type, _Precision>)
+			{
+				Simd::Store(_result.data() + i, Simd::template ReciprocalSqrt<_Precision == SqrtPrecision::MEDIUM>(values));
+			}
+			else
+			{
+				Simd::Store(_result.data() + i, Simd::Divide(one, Simd::Sqrt(values)));
+			}
+		}
+	}
+
+	for (; i < _result.size(); ++i)
+	{
+		if constexpr (SqrtImplementation::isApproximate<_Type, _Precision>)
+		{
+			_result[i] = SqrtImplementation::ReciprocalSqrt<_Precision>(_values[i]);
+		}
+		else
+		{
+			_result[i] = _Type(1) / std::sqrt(_values[i]);
+		}
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Calculates FastSqrt(...) of each value of _values
+* The values are not checked; the results for negative values are unspecified
+* _result may be the same array as _values
+*/
+template<SqrtPrecision _Precision = SqrtPrecision::MEDIUM, typename _Type>
+Status BatchFastSqrt(const std::span<_Type> _result, const std::span<const std::type_identity_t<_Type>> _values)
+{
+	static_assert(std::is_floating_point<_Type>::value, "Type of square root must be floating point");
+
+	SLR_ASSERT_ERROR(_values.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		for (; i + Simd::width <= _result.size(); i += Simd::width)
+		{
+			const typename Simd::Register values = Simd::Load(_values.data() + i);
+
+			if constexpr (SqrtImplementation::isApproximate<_Type, _Precision>)
+			{
+				// The estimate of 1 / sqrt(0) is infinity, so zeros are masked to keep the result at 0 rather than NaN
+				const typename Simd::Register estimate = Simd::template ReciprocalSqrt<_Precision == SqrtPrecision::MEDIUM>(values);
+
+				Simd::Store(_result.data() + i, Simd::ZeroWhere(Simd::IsZero(values), Simd::Multiply(values, estimate)));
+			}
+			else
+			{
+				Simd::Store(_result.data() + i, Simd::Sqrt(values));
+			}
+		}
+	}
+
+	for (; i < _result.size(); ++i)
+	{
+		if constexpr (SqrtImplementation::isApproximate<_Type, _Precision>)
+		{
+			_result[i] = _values[i] == 0 ? _Type(0) : _values[i] * SqrtImplementation::ReciprocalSqrt<_Precision>(_values[i]);
+		}
+		else
+		{
+			_result[i] = std::sqrt(_values[i]);
+		}
+	}
+
+	return Status::SUCCESS;
+}
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MATH_BATCHSQRT
\ No newline at end of file
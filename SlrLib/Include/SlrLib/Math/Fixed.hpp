@@ -0,0 +1,649 @@
+#pragma once
+#ifndef SLR_MATH_FIXED
+#define SLR_MATH_FIXED
+
+#include <compare>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/Simd.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* What happens when the result of a fixed point operation is outside of the representable range
+*/
+enum class FixedOverflow : word
+{
+	// The result wraps around, as unsigned integer arithmetic does
+	WRAP,
+
+	// The result is clamped to the minimum or maximum value
+	SATURATE
+};
+
+/**
+* Shared implementation of the fixed point type
+* This class is purely to hide the implementation from the user to make it clear not to interact with anything contained
+* within it
+* Every operation is done with integers, so results are identical on every platform and compiler, with or without SIMD.
+*/
+class FixedImplementation
+{
+public:
+	static constexpr i32 minimum = std::numeric_limits<i32>::min();
+	static constexpr i32 maximum = std::numeric_limits<i32>::max();
+
+	/**
+	* Narrows a wider result into the range of the raw value
+	*/
+	template<FixedOverflow _Overflow>
+	static constexpr i32 Narrow(const i64 _value)
+	{
+		if constexpr (_Overflow == FixedOverflow::SATURATE)
+		{
+			return _value < minimum ? minimum : (_value > maximum ? maximum : static_cast<i32>(_value));
+		}
+		else
+		{
+			// Conversion to a narrower signed type is modular
+			return static_cast<i32>(_value);
+		}
+	}
+
+	/**
+	* Returns _left * _right, where both have _FractionBits fractional bits, rounded to the nearest value with ties upwards
+	*/
+	template<word _FractionBits, FixedOverflow _Overflow>
+	static constexpr i32 Multiply(const i32 _left, const i32 _right)
+	{
+		const i64 product = static_cast<i64>(_left) * _right;
+
+		// Right shifts of negative values are arithmetic
+		return Narrow<_Overflow>((product + (i64(1) << (_FractionBits - 1))) >> _FractionBits);
+	}
+
+	/**
+	* Returns _left / _right, where both have _FractionBits fractional bits, rounded towards zero
+	* Dividing by zero gives the maximum or minimum value depending on the sign of _left, or zero for 0 / 0
+	*/
+	template<word _FractionBits, FixedOverflow _Overflow>
+	static constexpr i32 Divide(const i32 _left, const i32 _right)
+	{
+		if (_right == 0)
+		{
+			return _left > 0 ? maximum : (_left < 0 ? minimum : 0);
+		}
+
+		return Narrow<_Overflow>((static_cast<i64>(_left) * (i64(1) << _FractionBits)) / _right);
+	}
+
+	/**
+	* Returns the square root of _value rounded to the nearest integer, with the digit-by-digit method
+	*/
+	static constexpr u64 SqrtRounded(const u64 _value)
+	{
+		u64 remainder = _value;
+		u64 root = 0;
+		u64 bit = u64(1) << 62;
+
+		while (bit > _value)
+		{
+			bit >>= 2;
+		}
+
+		while (bit != 0)
+		{
+			if (remainder >= root + bit)
+			{
+				remainder -= root + bit;
+				root = (root >> 1) + bit;
+			}
+			else
+			{
+				root >>= 1;
+			}
+
+			bit >>= 2;
+		}
+
+		// The remainder is _value - root * root, and (root + 0.5)^2 = root * root + root + 0.25
+		return remainder > root ? root + 1 : root;
+	}
+
+	/**
+	* Adds _count raw values of _left and _right together
+	*/
+	template<FixedOverflow _Overflow>
+	static void Add(i32* _result, const i32* _left, const i32* _right, const size _count)
+	{
+		size i = 0;
+
+#ifdef SLR_SIMD_AVX2
+		for (; i + 8 <= _count; i += 8)
+		{
+			const __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_left + i));
+			const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_right + i));
+
+			__m256i sum = _mm256_add_epi32(left, right);
+
+			if constexpr (_Overflow == FixedOverflow::SATURATE)
+			{
+				// The addition overflowed if the sign of the sum differs from the sign of both values
+				const __m256i overflow = _mm256_and_si256(_mm256_xor_si256(left, sum), _mm256_xor_si256(right, sum));
+
+				sum = Saturate(sum, left, overflow);
+			}
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(_result + i), sum);
+		}
+#endif
+
+		for (; i < _count; ++i)
+		{
+			_result[i] = Narrow<_Overflow>(static_cast<i64>(_left[i]) + _right[i]);
+		}
+	}
+
+	/**
+	* Subtracts _count raw values of _right from _left
+	*/
+	template<FixedOverflow _Overflow>
+	static void Subtract(i32* _result, const i32* _left, const i32* _right, const size _count)
+	{
+		size i = 0;
+
+#ifdef SLR_SIMD_AVX2
+		for (; i + 8 <= _count; i += 8)
+		{
+			const __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_left + i));
+			const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_right + i));
+
+			__m256i difference = _mm256_sub_epi32(left, right);
+
+			if constexpr (_Overflow == FixedOverflow::SATURATE)
+			{
+				// The subtraction overflowed if the values differ in sign and the result differs in sign from _left
+				const __m256i overflow = _mm256_and_si256(_mm256_xor_si256(left, right), _mm256_xor_si256(left, difference));
+
+				difference = Saturate(difference, left, overflow);
+			}
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(_result + i), difference);
+		}
+#endif
+
+		for (; i < _count; ++i)
+		{
+			_result[i] = Narrow<_Overflow>(static_cast<i64>(_left[i]) - _right[i]);
+		}
+	}
+
+	/**
+	* Multiplies _count raw values of _left by those of _right
+	* If _right is a single value, it is used for every value of _left
+	*/
+	template<word _FractionBits, FixedOverflow _Overflow, bool _IsScalar>
+	static void Multiply(i32* _result, const i32* _left, const i32* _right, const size _count)
+	{
+		size i = 0;
+
+#ifdef SLR_SIMD_AVX2
+		const __m256i rounding = _mm256_set1_epi64x(i64(1) << (_FractionBits - 1));
+
+		for (; i + 8 <= _count; i += 8)
+		{
+			const __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_left + i));
+			const __m256i right = _IsScalar ? _mm256_set1_epi32(*_right) : _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_right + i));
+
+			// mul_epi32 multiplies the even lanes into 64-bit products, so the odd lanes are shifted down to be multiplied
+			const __m256i even = _mm256_add_epi64(_mm256_mul_epi32(left, right), rounding);
+			const __m256i odd = _mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(left, 32), _mm256_srli_epi64(right, 32)), rounding);
+
+			// Only the lower 32 bits of each shifted product are kept, which are the same for logical and arithmetic shifts
+			const __m256i evenResult = NarrowProducts<_FractionBits, _Overflow>(even);
+			const __m256i oddResult = NarrowProducts<_FractionBits, _Overflow>(odd);
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(_result + i), _mm256_blend_epi32(evenResult, _mm256_slli_epi64(oddResult, 32), 0b10101010));
+		}
+#endif
+
+		for (; i < _count; ++i)
+		{
+			_result[i] = Multiply<_FractionBits, _Overflow>(_left[i], _IsScalar ? *_right : _right[i]);
+		}
+	}
+
+private:
+#ifdef SLR_SIMD_AVX2
+	/**
+	* Replaces the values whose sign bit is set in _overflow with the maximum or minimum value matching the sign of _left
+	*/
+	static inline __m256i Saturate(const __m256i _value, const __m256i _left, const __m256i _overflow)
+	{
+		// A negative _left gives 0x80000000 and a positive one 0x7FFFFFFF
+		const __m256i saturated = _mm256_xor_si256(_mm256_srai_epi32(_left, 31), _mm256_set1_epi32(maximum));
+
+		return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(_value), _mm256_castsi256_ps(saturated), _mm256_castsi256_ps(_overflow)));
+	}
+
+	/**
+	* Shifts rounded 64-bit products down by _FractionBits, leaving the narrowed result in the lower 32 bits of each lane
+	*/
+	template<word _FractionBits, FixedOverflow _Overflow>
+	static inline __m256i NarrowProducts(const __m256i _products)
+	{
+		const __m256i shifted = _mm256_srli_epi64(_products, _FractionBits);
+
+		if constexpr (_Overflow == FixedOverflow::SATURATE)
+		{
+			// The shifted product fits if the product is within [-2^(31 + bits), 2^(31 + bits))
+			const __m256i upper = _mm256_set1_epi64x((i64(1) << (31 + _FractionBits)) - 1);
+			const __m256i lower = _mm256_set1_epi64x(-(i64(1) << (31 + _FractionBits)));
+
+			const __m256i isAbove = _mm256_cmpgt_epi64(_products, upper);
+			const __m256i isBelow = _mm256_cmpgt_epi64(lower, _products);
+
+			const __m256i clamped = _mm256_blendv_epi8(shifted, _mm256_set1_epi64x(maximum), isAbove);
+
+			return _mm256_blendv_epi8(clamped, _mm256_set1_epi64x(u32(minimum)), isBelow);
+		}
+		else
+		{
+			return shifted;
+		}
+	}
+#endif
+};
+
+/**
+* A signed fixed point number with _FractionBits fractional bits, stored in 32 bits
+* Every operation is done with integers, so results are bit-identical across platforms and compilers, which floats do not
+* guarantee. This makes it suitable for lockstep simulation, and it can be used as the component of a Vector2.
+* Fixed<16> covers [-32768, 32768) with a precision of 2^-16 (about 1.5e-5).
+* With FixedOverflow::WRAP, results outside of the range wrap around; with FixedOverflow::SATURATE they are clamped.
+* Multiplication rounds to the nearest value, with ties upwards, and division rounds towards zero.
+*/
+template<word _FractionBits, FixedOverflow _Overflow = FixedOverflow::WRAP>
+class Fixed
+{
+	static_assert(_FractionBits > 0 && _FractionBits < 31, "Fixed point numbers must have between 1 and 30 fractional bits");
+
+public:
+	static constexpr word fractionBits = _FractionBits;
+
+	static constexpr FixedOverflow overflow = _Overflow;
+
+	/**
+	* Default constructor
+	* Initializes the value to 0
+	*/
+	constexpr Fixed() : raw(0) {}
+
+	/**
+	* Constructor
+	* Takes an integer, which is exact as long as it is within range
+	*/
+	template<typename _Integer, std::enable_if_t<std::is_integral<_Integer>::value, int> = 0>
+	constexpr Fixed(const _Integer _value) : raw(FromInteger(_value)) {}
+
+	/**
+	* Constructor
+	* Takes a floating point value, rounding it to the nearest fixed point value with ties away from zero; NaN becomes 0
+	* The conversion is deterministic for a given input, but the input itself should not come from floating point calculations
+	* if the result needs to match across platforms
+	*/
+	template<typename _Float, std::enable_if_t<std::is_floating_point<_Float>::value, int> = 0>
+	explicit constexpr Fixed(const _Float _value) : raw(FromFloat(_value)) {}
+
+	/**
+	* Returns the fixed point number with the given raw value, which is the value multiplied by 2^_FractionBits
+	*/
+	static constexpr Fixed FromRaw(const i32 _raw)
+	{
+		Fixed result;
+		result.raw = _raw;
+
+		return result;
+	}
+
+	/**
+	* Returns the raw value, which is the value multiplied by 2^_FractionBits
+	*/
+	constexpr i32 GetRaw() const { return raw; }
+
+	static constexpr Fixed GetMaximum() { return FromRaw(FixedImplementation::maximum); }
+
+	static constexpr Fixed GetMinimum() { return FromRaw(FixedImplementation::minimum); }
+
+	/**
+	* Returns the smallest positive value
+	*/
+	static constexpr Fixed GetEpsilon() { return FromRaw(1); }
+
+	/**
+	* Conversion to floating point, which is exact for doubles
+	*/
+	template<typename _Float, std::enable_if_t<std::is_floating_point<_Float>::value, int> = 0>
+	explicit constexpr operator _Float() const
+	{
+		return static_cast<_Float>(raw) / static_cast<_Float>(i64(1) << _FractionBits);
+	}
+
+	/**
+	* Conversion to an integer, rounding towards negative infinity
+	*/
+	template<typename _Integer, std::enable_if_t<std::is_integral<_Integer>::value, int> = 0>
+	explicit constexpr operator _Integer() const
+	{
+		return static_cast<_Integer>(raw >> _FractionBits);
+	}
+
+	constexpr bool operator==(const Fixed& _rhs) const = default;
+
+	constexpr auto operator<=>(const Fixed& _rhs) const = default;
+
+	constexpr Fixed operator+() const { return *this; }
+
+	/**
+	* Unary negation operator
+	* Negating the minimum value gives the minimum value when wrapping, and the maximum value when saturating
+	*/
+	constexpr Fixed operator-() const { return FromRaw(FixedImplementation::Narrow<_Overflow>(-static_cast<i64>(raw))); }
+
+	constexpr Fixed& operator++() { return *this += Fixed(1); }
+
+	constexpr Fixed& operator--() { return *this -= Fixed(1); }
+
+	constexpr Fixed operator++(int) { Fixed temp = *this; ++*this; return temp; }
+
+	constexpr Fixed operator--(int) { Fixed temp = *this; --*this; return temp; }
+
+	constexpr Fixed& operator+=(const Fixed& _rhs) { return *this = *this + _rhs; }
+
+	constexpr Fixed& operator-=(const Fixed& _rhs) { return *this = *this - _rhs; }
+
+	constexpr Fixed& operator*=(const Fixed& _rhs) { return *this = *this * _rhs; }
+
+	constexpr Fixed& operator/=(const Fixed& _rhs) { return *this = *this / _rhs; }
+
+	constexpr Fixed& operator%=(const Fixed& _rhs) { return *this = *this % _rhs; }
+
+	/**
+	* The binary operators are friends so that integers on either side are converted
+	*/
+	friend constexpr Fixed operator+(const Fixed& _lhs, const Fixed& _rhs)
+	{
+		return FromRaw(FixedImplementation::Narrow<_Overflow>(static_cast<i64>(_lhs.raw) + _rhs.raw));
+	}
+
+	friend constexpr Fixed operator-(const Fixed& _lhs, const Fixed& _rhs)
+	{
+		return FromRaw(FixedImplementation::Narrow<_Overflow>(static_cast<i64>(_lhs.raw) - _rhs.raw));
+	}
+
+	friend constexpr Fixed operator*(const Fixed& _lhs, const Fixed& _rhs)
+	{
+		return FromRaw(FixedImplementation::Multiply<_FractionBits, _Overflow>(_lhs.raw, _rhs.raw));
+	}
+
+	friend constexpr Fixed operator/(const Fixed& _lhs, const Fixed& _rhs)
+	{
+		return FromRaw(FixedImplementation::Divide<_FractionBits, _Overflow>(_lhs.raw, _rhs.raw));
+	}
+
+	/**
+	* Remainder operator
+	* The result has the sign of _lhs, as with integers; the remainder of dividing by zero is zero
+	*/
+	friend constexpr Fixed operator%(const Fixed& _lhs, const Fixed& _rhs)
+	{
+		if (_rhs.raw == 0)
+		{
+			return Fixed();
+		}
+
+		return FromRaw(static_cast<i32>(static_cast<i64>(_lhs.raw) % _rhs.raw));
+	}
+
+private:
+	i32 raw;
+
+	template<typename _Integer>
+	static constexpr i32 FromInteger(const _Integer _value)
+	{
+		if constexpr (_Overflow == FixedOverflow::SATURATE)
+		{
+			constexpr i64 limit = i64(1) << (31 - _FractionBits);
+
+			if constexpr (std::is_signed<_Integer>::value)
+			{
+				if (_value < -limit)
+				{
+					return FixedImplementation::minimum;
+				}
+			}
+
+			if (_value >= 0 && static_cast<u64>(_value) >= static_cast<u64>(limit))
+			{
+				return FixedImplementation::maximum;
+			}
+
+			return static_cast<i32>(static_cast<i64>(_value) * (i64(1) << _FractionBits));
+		}
+		else
+		{
+			// Unsigned arithmetic wraps without undefined behaviour
+			return static_cast<i32>(static_cast<u32>(_value) << _FractionBits);
+		}
+	}
+
+	template<typename _Float>
+	static constexpr i32 FromFloat(const _Float _value)
+	{
+		if (_value != _value)
+		{
+			return 0;
+		}
+
+		const _Float scaled = _value * static_cast<_Float>(i64(1) << _FractionBits);
+
+		// Clamp before converting, as converting an out of range float to an integer is undefined
+		constexpr _Float limit = static_cast<_Float>(i64(1) << 62);
+		const _Float clamped = scaled < -limit ? -limit : (scaled > limit ? limit : scaled);
+
+		// Adding 0.5 before truncating would round the sum in _Float first, so round using the remainder instead; the integer
+		// part of a float is representable in the float, so the remainder is exact
+		i64 rounded = static_cast<i64>(clamped);
+		const _Float remainder = clamped - static_cast<_Float>(rounded);
+
+		if (remainder >= _Float(0.5))
+		{
+			++rounded;
+		}
+		else if (remainder <= _Float(-0.5))
+		{
+			--rounded;
+		}
+
+		if constexpr (_Overflow == FixedOverflow::SATURATE)
+		{
+			return FixedImplementation::Narrow<_Overflow>(rounded);
+		}
+		else
+		{
+			return static_cast<i32>(static_cast<u32>(static_cast<u64>(rounded)));
+		}
+	}
+};
+
+/**
+* Specialization marking fixed point numbers as numeric, so they can be used as the components of the math types
+*/
+template<word _FractionBits, FixedOverflow _Overflow>
+struct IsNumeric<Fixed<_FractionBits, _Overflow>> : std::true_type {};
+
+/**
+* Returns the square root of a fixed point value, rounded to the nearest value
+* The result is calculated with integers only, so it is the same on every platform
+* Fails if _value is negative
+*/
+template<word _FractionBits, FixedOverflow _Overflow>
+constexpr Status Sqrt(SLR_RETURN(Fixed<_FractionBits, _Overflow>) _result, const Fixed<_FractionBits, _Overflow> _value)
+{
+	SLR_ASSERT_ERROR(_value.GetRaw() >= 0, "Cannot calculate the square root of a negative value")
+	{
+		return Status::FAIL;
+	}
+
+	// sqrt(raw / 2^bits) * 2^bits = sqrt(raw * 2^bits), which fits within 31 bits for up to 30 fractional bits
+	const u64 root = FixedImplementation::SqrtRounded(static_cast<u64>(_value.GetRaw()) << _FractionBits);
+
+	_result = Fixed<_FractionBits, _Overflow>::FromRaw(static_cast<i32>(root));
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns sqrt(_x * _x + _y * _y), rounded to the nearest value
+* The squares are summed in 64 bits, so unlike the calculation with Fixed operators, they cannot overflow; only a result
+* beyond the maximum value wraps or saturates. This is used by Vector2::Magnitude(...) and Vector2::Normalized(...).
+*/
+template<word _FractionBits, FixedOverflow _Overflow>
+constexpr Status Hypot(
+	SLR_RETURN(Fixed<_FractionBits, _Overflow>) _result,
+	const Fixed<_FractionBits, _Overflow> _x,
+	const Fixed<_FractionBits, _Overflow> _y
+)
+{
+	const i64 x = _x.GetRaw();
+	const i64 y = _y.GetRaw();
+
+	// The raw values share a scale, so the square root of the sum of their squares is the raw magnitude
+	const u64 root = FixedImplementation::SqrtRounded(static_cast<u64>(x * x) + static_cast<u64>(y * y));
+
+	_result = Fixed<_FractionBits, _Overflow>::FromRaw(FixedImplementation::Narrow<_Overflow>(static_cast<i64>(root)));
+
+	return Status::SUCCESS;
+}
+
+/**
+* Adds each value of _left to the value of _right at the same index, using AVX2 when it is available
+* The results are identical to those of the + operator. An array of Vector2 can be processed by viewing its components.
+* _result may be the same array as _left or _right
+*/
+template<word _FractionBits, FixedOverflow _Overflow>
+Status BatchAdd(
+	const std::span<Fixed<_FractionBits, _Overflow>> _result,
+	const std::span<const Fixed<_FractionBits, _Overflow>> _left,
+	const std::span<const Fixed<_FractionBits, _Overflow>> _right
+)
+{
+	SLR_ASSERT_ERROR(_left.size() == _result.size() && _right.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	FixedImplementation::Add<_Overflow>(
+		reinterpret_cast<i32*>(_result.data()),
+		reinterpret_cast<const i32*>(_left.data()),
+		reinterpret_cast<const i32*>(_right.data()),
+		_result.size()
+	);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Subtracts each value of _right from the value of _left at the same index, using AVX2 when it is available
+* The results are identical to those of the - operator
+* _result may be the same array as _left or _right
+*/
+template<word _FractionBits, FixedOverflow _Overflow>
+Status BatchSubtract(
+	const std::span<Fixed<_FractionBits, _Overflow>> _result,
+	const std::span<const Fixed<_FractionBits, _Overflow>> _left,
+	const std::span<const Fixed<_FractionBits, _Overflow>> _right
+)
+{
+	SLR_ASSERT_ERROR(_left.size() == _result.size() && _right.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	FixedImplementation::Subtract<_Overflow>(
+		reinterpret_cast<i32*>(_result.data()),
+		reinterpret_cast<const i32*>(_left.data()),
+		reinterpret_cast<const i32*>(_right.data()),
+		_result.size()
+	);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Multiplies each value of _left by the value of _right at the same index, using AVX2 when it is available
+* The results are identical to those of the * operator
+* _result may be the same array as _left or _right
+*/
+template<word _FractionBits, FixedOverflow _Overflow>
+Status BatchMultiply(
+	const std::span<Fixed<_FractionBits, _Overflow>> _result,
+	const std::span<const Fixed<_FractionBits, _Overflow>> _left,
+	const std::span<const Fixed<_FractionBits, _Overflow>> _right
+)
+{
+	SLR_ASSERT_ERROR(_left.size() == _result.size() && _right.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	FixedImplementation::Multiply<_FractionBits, _Overflow, false>(
+		reinterpret_cast<i32*>(_result.data()),
+		reinterpret_cast<const i32*>(_left.data()),
+		reinterpret_cast<const i32*>(_right.data()),
+		_result.size()
+	);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Multiplies each value of _values by _scale, using AVX2 when it is available
+* The results are identical to those of the * operator
+* _result may be the same array as _values
+*/
+template<word _FractionBits, FixedOverflow _Overflow>
+Status BatchScale(
+	const std::span<Fixed<_FractionBits, _Overflow>> _result,
+	const std::span<const Fixed<_FractionBits, _Overflow>> _values,
+	const Fixed<_FractionBits, _Overflow> _scale
+)
+{
+	SLR_ASSERT_ERROR(_values.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	const i32 scale = _scale.GetRaw();
+
+	FixedImplementation::Multiply<_FractionBits, _Overflow, true>(
+		reinterpret_cast<i32*>(_result.data()),
+		reinterpret_cast<const i32*>(_values.data()),
+		&scale,
+		_result.size()
+	);
+
+	return Status::SUCCESS;
+}
+
+using Fixed16 = Fixed<16>;
+using SaturatedFixed16 = Fixed<16, FixedOverflow::SATURATE>;
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MATH_FIXED
\ No newline at end of file
@@ -4,38 +4,313 @@
 
 #include <type_traits>
 #include <cmath>
+#include <limits>
 #include <utility>
 
 #include "SlrLib/ErrorHandling/Exception.hpp"
 #include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/SimdDetect.hpp"
 #include "SlrLib/Utilities/Types.hpp"
 
+// The scalar reciprocal square root only needs SSE, so this avoids including every intrinsic through Simd.hpp
+#ifdef SLR_SIMD_SSE2
+#include <xmmintrin.h>
+#endif
+
 SLR_NAMESPACE_BEGIN
 
+/**
+* The precision of an approximate square root or reciprocal square root
+* The bounds are the maximum relative error for normal, positive floats. The hardware estimate differs between processors,
+* so they follow from the bound the instruction set guarantees rather than from measurements on any one processor; a
+* square root, calculated by multiplying by the reciprocal, adds one more float rounding. Without SSE, and for doubles, the
+* exact result is always calculated.
+*/
+enum class SqrtPrecision : word
+{
+	// The hardware estimate (rsqrtps) alone, with a relative error of at most 1.5 * 2^-12, about 3.7e-4 or 12 bits
+	LOW,
+
+	// The hardware estimate refined by one Newton-Raphson step, which leaves about 1.5 times the square of the estimate's
+	// error plus the rounding of the step itself, below 4.5e-7 or about 21 bits
+	MEDIUM,
+
+	// The exact result, calculated with a square root and a division
+	FULL
+};
+
+/**
+* Shared implementation of the approximate square root functions
+* This class is purely to hide the implementation from the user to make it clear not to interact with anything contained
+* within it
+*/
+class SqrtImplementation
+{
+public:
+	/**
+	* Whether the approximations are used for _Type, rather than the exact calculation
+	*/
+	template<typename _Type, SqrtPrecision _Precision>
+	static constexpr bool isApproximate =
+#ifdef SLR_SIMD_SSE2
+		std::is_same<_Type, float>::value && _Precision != SqrtPrecision::FULL;
+#else
+		false;
+#endif
+
+	/**
+	* Returns the approximate reciprocal square root of a positive float
+	*/
+	template<SqrtPrecision _Precision>
+	static inline float ReciprocalSqrt(const float _value)
+	{
+#ifdef SLR_SIMD_SSE2
+		const float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(_value)));
+
+		if constexpr (_Precision == SqrtPrecision::LOW)
+		{
+			return estimate;
+		}
+		else
+		{
+			// One Newton-Raphson step for 1 / sqrt(value) roughly doubles the number of correct bits
+			return estimate * (1.5f - ((0.5f * _value) * (estimate * estimate)));
+		}
+#else
+		return 1.0f / std::sqrt(_value);
+#endif
+	}
+
+	/**
+	* Returns the square root of a non-negative value without calling std::sqrt, so it can be constant evaluated
+	* The value is scaled by powers of 4 into [1, 4), which is exact, then Newton-Raphson iteration runs from above until it
+	* stops decreasing. The last step can leave the root one unit in the last place out, so the exact residual is used to
+	* round it correctly, matching std::sqrt.
+	*/
+	template<typename _Type>
+	static constexpr _Type ConstantSqrt(const _Type _value)
+	{
+		// Zero, infinity and NaN are their own square roots
+		if (_value == 0 || _value != _value || _value > std::numeric_limits<_Type>::max())
+		{
+			return _value;
+		}
+
+		_Type value = _value;
+		_Type scale = 1;
+
+		while (value >= 4)
+		{
+			value *= _Type(0.25);
+			scale *= 2;
+		}
+
+		while (value < 1)
+		{
+			value *= 4;
+			scale *= _Type(0.5);
+		}
+
+		// (1 + value) / 2 is never below the square root, so each iteration decreases until it converges
+		_Type root = (1 + value) * _Type(0.5);
+
+		while (true)
+		{
+			const _Type next = (root + (value / root)) * _Type(0.5);
+
+			if (next >= root)
+			{
+				break;
+			}
+
+			root = next;
+		}
+
+		// The root is within one unit in the last place of the exact root. A square root is never exactly halfway between two
+		// values, so the root is correctly rounded once (root - below / 2)^2 < value < (root + above / 2)^2, where below and
+		// above are the distances to its neighbours. (root + above / 2)^2 is root * (root + above) + (above / 2)^2, and
+		// value - root * (root + above) is a multiple of above^2, so value is beyond the midpoint exactly when it's greater
+		// than root * (root + above); the same holds below the root. The distances double from 2 and halve below 1.
+		const _Type unit = std::numeric_limits<_Type>::epsilon();
+
+		while (true)
+		{
+			const _Type above = root >= 2 ? unit * 2 : unit;
+			const _Type below = root > 1 ? unit : unit * _Type(0.5);
+
+			if (Residual(value, root, root + above) > 0)
+			{
+				root += above;
+			}
+			else if (!(Residual(value, root, root - below) > 0))
+			{
+				root -= below;
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		return root * scale;
+	}
+
+private:
+	/**
+	* Returns _value - _left * _right, rounded only once so its sign is exact, using Dekker's algorithm
+	* _value must be within a factor of 2 of the product. This relies on the products not being contracted into fused
+	* multiply-adds, which never happens in constant evaluation
+	*/
+	template<typename _Type>
+	static constexpr _Type Residual(const _Type _value, const _Type _left, const _Type _right)
+	{
+		// Splits each factor into two halves, whose products with each other are exact
+		constexpr _Type splitter = static_cast<_Type>((1ull << ((std::numeric_limits<_Type>::digits + 1) / 2)) + 1);
+
+		const _Type leftSplit = splitter * _left;
+		const _Type leftHigh = leftSplit - (leftSplit - _left);
+		const _Type leftLow = _left - leftHigh;
+
+		const _Type rightSplit = splitter * _right;
+		const _Type rightHigh = rightSplit - (rightSplit - _right);
+		const _Type rightLow = _right - rightHigh;
+
+		// The product is exactly product + error
+		const _Type product = _left * _right;
+		const _Type error =
+			((((leftHigh * rightHigh) - product) + (leftHigh * rightLow)) + (leftLow * rightHigh)) + (leftLow * rightLow);
+
+		// The value and product are within a factor of 2 of each other, so the subtraction is exact, leaving one rounding
+		return (_value - product) - error;
+	}
+};
+
+// ConstantSqrt(...) must round exactly as std::sqrt does. The largest values with an odd exponent have roots just below a
+// power of 2, which they must not round up to
+static_assert(SqrtImplementation::ConstantSqrt(std::numeric_limits<double>::max()) == 0x1.fffffffffffffp+511);
+static_assert(SqrtImplementation::ConstantSqrt(std::numeric_limits<float>::max()) == 0x1.fffffep+63f);
+static_assert(SqrtImplementation::ConstantSqrt(0x1.fffffffffffffp+1) == 0x1.fffffffffffffp+0);
+static_assert(SqrtImplementation::ConstantSqrt(0x1.fffffep+1f) == 0x1.fffffep+0f);
+static_assert(SqrtImplementation::ConstantSqrt(std::numeric_limits<double>::denorm_min()) == 0x1p-537);
+static_assert(SqrtImplementation::ConstantSqrt(2.0) == 0x1.6a09e667f3bcdp+0);
+
 /**
 * Returns the square root of a value
+* During constant evaluation, the square root is calculated by ConstantSqrt(...) rather than std::sqrt, so this can be used
+* to initialize constants and lookup tables at compile time
+* Fails if _value is negative
+*/
+template<typename _Type>
+constexpr Status Sqrt(SLR_RETURN(_Type) _result, const _Type _value)
+{
+	if constexpr (std::is_signed<_Type>::value)
+	{
+		SLR_ASSERT_ERROR(!(_value < 0), "Cannot calculate the square root of a negative value")
+		{
+			return Status::FAIL;
+		}
+	}
+
+	if (std::is_constant_evaluated())
+	{
+		// Integers are calculated as doubles, as std::sqrt would
+		using Calculation = std::conditional_t<std::is_floating_point<_Type>::value, _Type, double>;
+
+		_result = static_cast<_Type>(SqrtImplementation::ConstantSqrt(static_cast<Calculation>(_value)));
+
+		return Status::SUCCESS;
+	}
+
+	_result = static_cast<_Type>(std::sqrt(_value));
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns sqrt(_x * _x + _y * _y)
+* For the arithmetic types this is calculated directly, without the overflow protection of std::hypot, so that it matches
+* Vector2::Magnitude(...); numeric classes such as Fixed overload it to avoid overflowing the squares
 */
 template<typename _Type>
-Status Sqrt(SLR_RETURN(_Type) _result, const _Type _value)
+constexpr Status Hypot(SLR_RETURN(_Type) _result, const _Type _x, const _Type _y)
 {
-	// TODO: Error handling
+	return Sqrt(_result, (_x * _x) + (_y * _y));
+}
 
-	_result = std::sqrt(_value);
+/**
+* Returns an approximation of 1 / sqrt(_value)
+* Refer to SqrtPrecision for the error bounds
+* Fails if _value is not positive
+*/
+template<SqrtPrecision _Precision = SqrtPrecision::MEDIUM, typename _Type>
+constexpr Status RSqrt(SLR_RETURN(_Type) _result, const _Type _value)
+{
+	static_assert(std::is_floating_point<_Type>::value, "Type of reciprocal square root must be floating point");
+
+	SLR_ASSERT_ERROR(_value > 0, "Cannot calculate the reciprocal square root of a value which isn't positive")
+	{
+		return Status::FAIL;
+	}
+
+	if constexpr (SqrtImplementation::isApproximate<_Type, _Precision>)
+	{
+		if (!std::is_constant_evaluated())
+		{
+			_result = SqrtImplementation::ReciprocalSqrt<_Precision>(_value);
+
+			return Status::SUCCESS;
+		}
+	}
+
+	// The exact calculation is always used during constant evaluation
+	_Type root;
+	Sqrt(root, _value);
+
+	_result = _Type(1) / root;
 
 	return Status::SUCCESS;
 }
 
+/**
+* Returns an approximation of the square root of _value, calculated as _value * RSqrt(_value)
+* Refer to SqrtPrecision for the error bounds; the square root of 0 is exactly 0
+* Fails if _value is negative
+*/
+template<SqrtPrecision _Precision = SqrtPrecision::MEDIUM, typename _Type>
+constexpr Status FastSqrt(SLR_RETURN(_Type) _result, const _Type _value)
+{
+	static_assert(std::is_floating_point<_Type>::value, "Type of square root must be floating point");
+
+	SLR_ASSERT_ERROR(_value >= 0, "Cannot calculate the square root of a negative value")
+	{
+		return Status::FAIL;
+	}
+
+	if constexpr (SqrtImplementation::isApproximate<_Type, _Precision>)
+	{
+		if (!std::is_constant_evaluated())
+		{
+			_result = _value == 0 ? _Type(0) : _value * SqrtImplementation::ReciprocalSqrt<_Precision>(_value);
+
+			return Status::SUCCESS;
+		}
+	}
+
+	// The exact calculation is always used during constant evaluation
+	return Sqrt(_result, _value);
+}
+
 /**
 * 
 */
 template<typename _Type, typename ... _Others>
-Status MinHelper(SLR_RETURN(_Type) _result, const _Type& _first, _Others&&... _others);
+constexpr Status MinHelper(SLR_RETURN(_Type) _result, const _Type& _first, _Others&&... _others);
 
 /**
 * 
 */
 template<typename _Type>
-Status Min(SLR_RETURN(_Type) _result, const _Type _value)
+constexpr Status Min(SLR_RETURN(_Type) _result, const _Type _value)
 {
 	_result = _value;
 	return Status::SUCCESS;
@@ -45,7 +320,7 @@ Status Min(SLR_RETURN(_Type) _result, const _Type _value)
 * 
 */
 template<typename _Type>
-Status Min(SLR_RETURN(_Type) _result, const _Type _left, const _Type _right)
+constexpr Status Min(SLR_RETURN(_Type) _result, const _Type _left, const _Type _right)
 {
 	_result = _left < _right ? _left : _right;
 
@@ -56,7 +331,7 @@ Status Min(SLR_RETURN(_Type) _result, const _Type _left, const _Type _right)
 * 
 */
 template<typename _Type, typename ... _Others>
-Status Min(SLR_RETURN(_Type) _result, const _Type _first, _Others&&... _others)
+constexpr Status Min(SLR_RETURN(_Type) _result, const _Type _first, _Others&&... _others)
 {
 	return MinHelper(_result, _first, std::forward<_Others>(_others)...);
 }
@@ -65,7 +340,7 @@ Status Min(SLR_RETURN(_Type) _result, const _Type _first, _Others&&... _others)
 * 
 */
 template<typename _Type, typename ... _Others>
-Status MinHelper(SLR_RETURN(_Type) _result, const _Type& _first, _Others&&... _others)
+constexpr Status MinHelper(SLR_RETURN(_Type) _result, const _Type& _first, _Others&&... _others)
 {
 	_Type temp;
 	Min(temp, std::forward<_Others>(_others)...);
@@ -74,6 +349,72 @@ Status MinHelper(SLR_RETURN(_Type) _result, const _Type& _first, _Others&&... _o
 	return Status::SUCCESS;
 }
 
+/**
+* Declaration of MaxHelper so that Max can call it
+*/
+template<typename _Type, typename ... _Others>
+constexpr Status MaxHelper(SLR_RETURN(_Type) _result, const _Type& _first, _Others&&... _others);
+
+/**
+* Returns the value, as it's the largest of one value
+*/
+template<typename _Type>
+constexpr Status Max(SLR_RETURN(_Type) _result, const _Type _value)
+{
+	_result = _value;
+	return Status::SUCCESS;
+}
+
+/**
+* Returns the larger of two values
+*/
+template<typename _Type>
+constexpr Status Max(SLR_RETURN(_Type) _result, const _Type _left, const _Type _right)
+{
+	_result = _left < _right ? _right : _left;
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns the largest of any number of values
+*/
+template<typename _Type, typename ... _Others>
+constexpr Status Max(SLR_RETURN(_Type) _result, const _Type _first, _Others&&... _others)
+{
+	return MaxHelper(_result, _first, std::forward<_Others>(_others)...);
+}
+
+/**
+* Returns the larger of _first and the largest of _others
+*/
+template<typename _Type, typename ... _Others>
+constexpr Status MaxHelper(SLR_RETURN(_Type) _result, const _Type& _first, _Others&&... _others)
+{
+	_Type temp;
+	Max(temp, std::forward<_Others>(_others)...);
+	Max(_result, _first, temp);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns _value limited to the range [_minimum, _maximum]
+* Fails if _minimum is greater than _maximum
+*/
+template<typename _Type>
+constexpr Status Clamp(SLR_RETURN(_Type) _result, const _Type _value, const _Type _minimum, const _Type _maximum)
+{
+	SLR_ASSERT_ERROR(!(_maximum < _minimum), "Minimum of clamp range is greater than the maximum")
+	{
+		return Status::FAIL;
+	}
+
+	_result = _value < _minimum ? _minimum : (_maximum < _value ? _maximum : _value);
+
+	return Status::SUCCESS;
+}
+
 SLR_NAMESPACE_END
 
 #endif // ifndef SLR_MATH_FUNCTIONS
\ No newline at end of file
@@ -0,0 +1,306 @@
+#pragma once
+#ifndef SLR_MATH_MATRIX2X2
+#define SLR_MATH_MATRIX2X2
+
+#include <cmath>
+#include <span>
+#include <type_traits>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/SimdBatch.hpp"
+#include "SlrLib/Math/Vector2.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* Shared implementation of the matrix kernels
+* This class is purely to hide the implementation from the user to make it clear not to interact with anything contained
+* within it
+*/
+class MatrixImplementation
+{
+public:
+	/**
+	* Computes (_xx * x + _xy * y + _xTranslation, _yx * x + _yy * y + _yTranslation) for each point
+	* FMA is deliberately not used so that floating point results match transforming each point individually, provided the
+	* compiler doesn't contract the scalar expressions into FMA either; refer to TransformVectors(...)
+	* _result may be the same array as _points
+	*/
+	template<typename _Type>
+	static void TransformAffine(
+		const std::span<Vector2<_Type>> _result,
+		const std::span<const Vector2<_Type>> _points,
+		const _Type _xx, const _Type _xy, const _Type _xTranslation,
+		const _Type _yx, const _Type _yy, const _Type _yTranslation
+	)
+	{
+		size i = 0;
+
+		if constexpr (SimdBatch<_Type>::isEnabled)
+		{
+			using Simd = SimdBatch<_Type>;
+
+			static_assert(sizeof(Vector2<_Type>) == 2 * sizeof(_Type), "Vector2 must not contain any padding");
+
+			_Type* result = reinterpret_cast<_Type*>(_result.data());
+			const _Type* points = reinterpret_cast<const _Type*>(_points.data());
+
+			// The columns of the matrix, repeated for each point within a register
+			const typename Simd::Register xColumn = Simd::BroadcastPair(_xx, _yx);
+			const typename Simd::Register yColumn = Simd::BroadcastPair(_xy, _yy);
+			const typename Simd::Register translation = Simd::BroadcastPair(_xTranslation, _yTranslation);
+
+			// Each iteration processes one register of interleaved components, which is half a register of points
+			for (; 2 * i + Simd::width <= 2 * _result.size(); i += Simd::width / 2)
+			{
+				const typename Simd::Register components = Simd::Load(points + 2 * i);
+
+				const typename Simd::Register x = Simd::Multiply(Simd::DuplicateX(components), xColumn);
+				const typename Simd::Register y = Simd::Multiply(Simd::DuplicateY(components), yColumn);
+
+				Simd::Store(result + 2 * i, Simd::Add(Simd::Add(x, y), translation));
+			}
+		}
+
+		for (; i < _result.size(); ++i)
+		{
+			const Vector2<_Type> point = _points[i];
+
+			_result[i] = Vector2<_Type>(
+				((_xx * point.x) + (_xy * point.y)) + _xTranslation,
+				((_yx * point.x) + (_yy * point.y)) + _yTranslation
+			);
+		}
+	}
+};
+
+/**
+* A 2x2 matrix, used for linear transformations of 2D vectors
+* Elements are stored in row-major order, and vectors are treated as columns, so a vector is transformed by multiplying it
+* on the right of the matrix. Therefore, for A * B, B is applied first.
+*/
+template<typename _Type>
+struct Matrix2x2
+{
+	static_assert(std::is_arithmetic<_Type>::value, "Type of matrix template must be numeric");
+
+	/**
+	* The elements of the matrix, accessed as elements[row][column]
+	*/
+	_Type elements[2][2];
+
+	/**
+	* Default constructor
+	* Default initializes every element to 0
+	*/
+	constexpr Matrix2x2() : elements{ { 0, 0 }, { 0, 0 } } {}
+
+	/**
+	* Constructor
+	* Takes the four elements in row-major order
+	*/
+	constexpr Matrix2x2(const _Type& _xx, const _Type& _xy, const _Type& _yx, const _Type& _yy) :
+		elements{ { _xx, _xy }, { _yx, _yy } }
+	{}
+
+	/**
+	* Equal to operator
+	* Returns true if every element is equal
+	*/
+	constexpr bool operator==(const Matrix2x2& _rhs) const
+	{
+		return
+			elements[0][0] == _rhs.elements[0][0] && elements[0][1] == _rhs.elements[0][1] &&
+			elements[1][0] == _rhs.elements[1][0] && elements[1][1] == _rhs.elements[1][1];
+	}
+
+	/**
+	* Not equal to operator
+	* Returns true if any element is not equal
+	*/
+	constexpr bool operator!=(const Matrix2x2& _rhs) const { return !(*this == _rhs); }
+
+	/**
+	* Multiplication operator
+	* Composes the two transformations; the result applies _rhs first, then this matrix
+	*/
+	constexpr Matrix2x2 operator*(const Matrix2x2& _rhs) const
+	{
+		return Matrix2x2(
+			(elements[0][0] * _rhs.elements[0][0]) + (elements[0][1] * _rhs.elements[1][0]),
+			(elements[0][0] * _rhs.elements[0][1]) + (elements[0][1] * _rhs.elements[1][1]),
+			(elements[1][0] * _rhs.elements[0][0]) + (elements[1][1] * _rhs.elements[1][0]),
+			(elements[1][0] * _rhs.elements[0][1]) + (elements[1][1] * _rhs.elements[1][1])
+		);
+	}
+
+	/**
+	* Multiplication operator
+	* Transforms a vector by this matrix
+	*/
+	constexpr Vector2<_Type> operator*(const Vector2<_Type>& _rhs) const
+	{
+		return Vector2<_Type>(
+			(elements[0][0] * _rhs.x) + (elements[0][1] * _rhs.y),
+			(elements[1][0] * _rhs.x) + (elements[1][1] * _rhs.y)
+		);
+	}
+
+	/**
+	* Multiplication assignment operator
+	* The result applies _rhs first, then this matrix
+	*/
+	constexpr Matrix2x2& operator*=(const Matrix2x2& _rhs) { return *this = *this * _rhs; }
+
+	/**
+	* Returns the determinant of the matrix
+	*/
+	constexpr Status Determinant(SLR_RETURN(_Type) _result) const
+	{
+		_result = (elements[0][0] * elements[1][1]) - (elements[0][1] * elements[1][0]);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the inverse of the matrix
+	* Fails if the determinant is zero, as the matrix has no inverse
+	*/
+	constexpr Status Inverse(SLR_RETURN(Matrix2x2) _result) const
+	{
+		_Type determinant;
+		this->Determinant(determinant);
+
+		SLR_ASSERT_ERROR(determinant != 0, "Determinant resulted to zero and therefore the matrix cannot be inverted")
+		{
+			return Status::FAIL;
+		}
+
+		// Get the inverse determinant of the matrix
+		const _Type inverseDeterminant = _Type(1) / determinant;
+
+		_result = Matrix2x2(
+			elements[1][1] * inverseDeterminant,
+			-elements[0][1] * inverseDeterminant,
+			-elements[1][0] * inverseDeterminant,
+			elements[0][0] * inverseDeterminant
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the transpose of the matrix
+	*/
+	constexpr Status Transposed(SLR_RETURN(Matrix2x2) _result) const
+	{
+		_result = Matrix2x2(elements[0][0], elements[1][0], elements[0][1], elements[1][1]);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a vector transformed by this matrix
+	*/
+	constexpr Status TransformVector(SLR_RETURN(Vector2<_Type>) _result, const Vector2<_Type>& _vector) const
+	{
+		_result = *this * _vector;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a matrix of a different data type
+	*/
+	template<typename _ParseType>
+	constexpr Status AsType(SLR_RETURN(Matrix2x2<_ParseType>) _result) const
+	{
+		_result = Matrix2x2<_ParseType>(
+			static_cast<_ParseType>(elements[0][0]), static_cast<_ParseType>(elements[0][1]),
+			static_cast<_ParseType>(elements[1][0]), static_cast<_ParseType>(elements[1][1])
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the identity matrix
+	*/
+	static constexpr Status GetIdentityMatrix(SLR_RETURN(Matrix2x2) _result)
+	{
+		_result = Matrix2x2(1, 0, 0, 1);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a zero matrix
+	*/
+	static constexpr Status GetZeroMatrix(SLR_RETURN(Matrix2x2) _result)
+	{
+		_result = Matrix2x2(0, 0, 0, 0);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a matrix which rotates vectors anti-clockwise by _radians
+	*/
+	static Status CreateRotation(SLR_RETURN(Matrix2x2) _result, const _Type _radians)
+	{
+		const _Type sine = static_cast<_Type>(std::sin(_radians));
+		const _Type cosine = static_cast<_Type>(std::cos(_radians));
+
+		_result = Matrix2x2(cosine, -sine, sine, cosine);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a matrix which scales the x and y components of vectors by the components of _scale
+	*/
+	static constexpr Status CreateScale(SLR_RETURN(Matrix2x2) _result, const Vector2<_Type>& _scale)
+	{
+		_result = Matrix2x2(_scale.x, 0, 0, _scale.y);
+
+		return Status::SUCCESS;
+	}
+};
+
+/**
+* Transforms each vector of _vectors by _matrix
+* For floating point types, the results compare equal to transforming each vector individually with TransformVector(...)
+* only if the compiler doesn't contract `a * b + c` into a fused multiply-add, which is the default for MSVC and requires
+* -ffp-contract=off with GCC and Clang when FMA instructions are enabled. Otherwise the individual transform may be fused,
+* rounding once instead of twice, and the results may differ in the low bits, or further where the terms cancel out.
+* _result may be the same array as _vectors
+*/
+template<typename _Type>
+Status TransformVectors(
+	const std::span<Vector2<_Type>> _result,
+	const std::span<const Vector2<std::type_identity_t<_Type>>> _vectors,
+	const Matrix2x2<std::type_identity_t<_Type>>& _matrix
+)
+{
+	SLR_ASSERT_ERROR(_vectors.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	MatrixImplementation::TransformAffine<_Type>(
+		_result, _vectors,
+		_matrix.elements[0][0], _matrix.elements[0][1], 0,
+		_matrix.elements[1][0], _matrix.elements[1][1], 0
+	);
+
+	return Status::SUCCESS;
+}
+
+using Matrix2x2f = Matrix2x2<float>;
+using Matrix2x2d = Matrix2x2<double>;
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MATH_MATRIX2X2
\ No newline at end of file
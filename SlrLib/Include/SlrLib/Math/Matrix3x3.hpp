@@ -0,0 +1,312 @@
+#pragma once
+#ifndef SLR_MATH_MATRIX3X3
+#define SLR_MATH_MATRIX3X3
+
+#include <cmath>
+#include <span>
+#include <type_traits>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Math/Matrix2x2.hpp"
+#include "SlrLib/Math/Vector2.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* A 3x3 matrix, used for affine transformations of 2D points
+* Elements are stored in row-major order, and points are treated as columns of (x, y, 1), so the translation is held within
+* the last column. For A * B, B is applied first.
+* Transforming a point assumes the last row is (0, 0, 1), which holds for any composition of the matrices created by this
+* type.
+*/
+template<typename _Type>
+struct Matrix3x3
+{
+	static_assert(std::is_arithmetic<_Type>::value, "Type of matrix template must be numeric");
+
+	/**
+	* The elements of the matrix, accessed as elements[row][column]
+	*/
+	_Type elements[3][3];
+
+	/**
+	* Default constructor
+	* Default initializes every element to 0
+	*/
+	constexpr Matrix3x3() : elements{ { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } } {}
+
+	/**
+	* Constructor
+	* Takes the nine elements in row-major order
+	*/
+	constexpr Matrix3x3(
+		const _Type& _e00, const _Type& _e01, const _Type& _e02,
+		const _Type& _e10, const _Type& _e11, const _Type& _e12,
+		const _Type& _e20, const _Type& _e21, const _Type& _e22
+	) :
+		elements{ { _e00, _e01, _e02 }, { _e10, _e11, _e12 }, { _e20, _e21, _e22 } }
+	{}
+
+	/**
+	* Constructor
+	* Takes a linear transformation and a translation which is applied after it
+	*/
+	constexpr Matrix3x3(const Matrix2x2<_Type>& _linear, const Vector2<_Type>& _translation) :
+		elements{
+			{ _linear.elements[0][0], _linear.elements[0][1], _translation.x },
+			{ _linear.elements[1][0], _linear.elements[1][1], _translation.y },
+			{ 0, 0, 1 }
+		}
+	{}
+
+	/**
+	* Equal to operator
+	* Returns true if every element is equal
+	*/
+	constexpr bool operator==(const Matrix3x3& _rhs) const
+	{
+		for (size row = 0; row < 3; ++row)
+		{
+			for (size column = 0; column < 3; ++column)
+			{
+				if (elements[row][column] != _rhs.elements[row][column])
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	* Not equal to operator
+	* Returns true if any element is not equal
+	*/
+	constexpr bool operator!=(const Matrix3x3& _rhs) const { return !(*this == _rhs); }
+
+	/**
+	* Multiplication operator
+	* Composes the two transformations; the result applies _rhs first, then this matrix
+	*/
+	constexpr Matrix3x3 operator*(const Matrix3x3& _rhs) const
+	{
+		Matrix3x3 result;
+
+		for (size row = 0; row < 3; ++row)
+		{
+			for (size column = 0; column < 3; ++column)
+			{
+				result.elements[row][column] =
+					(elements[row][0] * _rhs.elements[0][column]) +
+					(elements[row][1] * _rhs.elements[1][column]) +
+					(elements[row][2] * _rhs.elements[2][column]);
+			}
+		}
+
+		return result;
+	}
+
+	/**
+	* Multiplication assignment operator
+	* The result applies _rhs first, then this matrix
+	*/
+	constexpr Matrix3x3& operator*=(const Matrix3x3& _rhs) { return *this = *this * _rhs; }
+
+	/**
+	* Returns the determinant of the matrix
+	*/
+	constexpr Status Determinant(SLR_RETURN(_Type) _result) const
+	{
+		// Expand along the first row
+		_result =
+			(elements[0][0] * ((elements[1][1] * elements[2][2]) - (elements[1][2] * elements[2][1]))) -
+			(elements[0][1] * ((elements[1][0] * elements[2][2]) - (elements[1][2] * elements[2][0]))) +
+			(elements[0][2] * ((elements[1][0] * elements[2][1]) - (elements[1][1] * elements[2][0])));
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the inverse of the matrix
+	* Fails if the determinant is zero, as the matrix has no inverse
+	*/
+	constexpr Status Inverse(SLR_RETURN(Matrix3x3) _result) const
+	{
+		_Type determinant;
+		this->Determinant(determinant);
+
+		SLR_ASSERT_ERROR(determinant != 0, "Determinant resulted to zero and therefore the matrix cannot be inverted")
+		{
+			return Status::FAIL;
+		}
+
+		// Get the inverse determinant of the matrix
+		const _Type inverseDeterminant = _Type(1) / determinant;
+
+		// The inverse is the adjugate, the transpose of the cofactor matrix, divided by the determinant
+		const auto& e = elements;
+
+		_result = Matrix3x3(
+			((e[1][1] * e[2][2]) - (e[1][2] * e[2][1])) * inverseDeterminant,
+			((e[0][2] * e[2][1]) - (e[0][1] * e[2][2])) * inverseDeterminant,
+			((e[0][1] * e[1][2]) - (e[0][2] * e[1][1])) * inverseDeterminant,
+			((e[1][2] * e[2][0]) - (e[1][0] * e[2][2])) * inverseDeterminant,
+			((e[0][0] * e[2][2]) - (e[0][2] * e[2][0])) * inverseDeterminant,
+			((e[0][2] * e[1][0]) - (e[0][0] * e[1][2])) * inverseDeterminant,
+			((e[1][0] * e[2][1]) - (e[1][1] * e[2][0])) * inverseDeterminant,
+			((e[0][1] * e[2][0]) - (e[0][0] * e[2][1])) * inverseDeterminant,
+			((e[0][0] * e[1][1]) - (e[0][1] * e[1][0])) * inverseDeterminant
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the transpose of the matrix
+	*/
+	constexpr Status Transposed(SLR_RETURN(Matrix3x3) _result) const
+	{
+		for (size row = 0; row < 3; ++row)
+		{
+			for (size column = 0; column < 3; ++column)
+			{
+				_result.elements[row][column] = elements[column][row];
+			}
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a point transformed by this matrix, including the translation
+	*/
+	constexpr Status TransformPoint(SLR_RETURN(Vector2<_Type>) _result, const Vector2<_Type>& _point) const
+	{
+		_result = Vector2<_Type>(
+			((elements[0][0] * _point.x) + (elements[0][1] * _point.y)) + elements[0][2],
+			((elements[1][0] * _point.x) + (elements[1][1] * _point.y)) + elements[1][2]
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a vector transformed by this matrix, excluding the translation
+	*/
+	constexpr Status TransformVector(SLR_RETURN(Vector2<_Type>) _result, const Vector2<_Type>& _vector) const
+	{
+		_result = Vector2<_Type>(
+			(elements[0][0] * _vector.x) + (elements[0][1] * _vector.y),
+			(elements[1][0] * _vector.x) + (elements[1][1] * _vector.y)
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a matrix of a different data type
+	*/
+	template<typename _ParseType>
+	constexpr Status AsType(SLR_RETURN(Matrix3x3<_ParseType>) _result) const
+	{
+		for (size row = 0; row < 3; ++row)
+		{
+			for (size column = 0; column < 3; ++column)
+			{
+				_result.elements[row][column] = static_cast<_ParseType>(elements[row][column]);
+			}
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the identity matrix
+	*/
+	static constexpr Status GetIdentityMatrix(SLR_RETURN(Matrix3x3) _result)
+	{
+		_result = Matrix3x3(1, 0, 0, 0, 1, 0, 0, 0, 1);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a zero matrix
+	*/
+	static constexpr Status GetZeroMatrix(SLR_RETURN(Matrix3x3) _result)
+	{
+		_result = Matrix3x3(0, 0, 0, 0, 0, 0, 0, 0, 0);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a matrix which translates points by _translation
+	*/
+	static constexpr Status CreateTranslation(SLR_RETURN(Matrix3x3) _result, const Vector2<_Type>& _translation)
+	{
+		_result = Matrix3x3(1, 0, _translation.x, 0, 1, _translation.y, 0, 0, 1);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a matrix which rotates points anti-clockwise about the origin by _radians
+	*/
+	static Status CreateRotation(SLR_RETURN(Matrix3x3) _result, const _Type _radians)
+	{
+		const _Type sine = static_cast<_Type>(std::sin(_radians));
+		const _Type cosine = static_cast<_Type>(std::cos(_radians));
+
+		_result = Matrix3x3(cosine, -sine, 0, sine, cosine, 0, 0, 0, 1);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a matrix which scales the x and y components of points about the origin by the components of _scale
+	*/
+	static constexpr Status CreateScale(SLR_RETURN(Matrix3x3) _result, const Vector2<_Type>& _scale)
+	{
+		_result = Matrix3x3(_scale.x, 0, 0, 0, _scale.y, 0, 0, 0, 1);
+
+		return Status::SUCCESS;
+	}
+};
+
+/**
+* Transforms each point of _points by _matrix, including the translation
+* The results are identical to transforming each point individually with TransformPoint(...), under the same condition on
+* floating point contraction as TransformVectors(...) for Matrix2x2
+* _result may be the same array as _points
+*/
+template<typename _Type>
+Status TransformPoints(
+	const std::span<Vector2<_Type>> _result,
+	const std::span<const Vector2<std::type_identity_t<_Type>>> _points,
+	const Matrix3x3<std::type_identity_t<_Type>>& _matrix
+)
+{
+	SLR_ASSERT_ERROR(_points.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	MatrixImplementation::TransformAffine<_Type>(
+		_result, _points,
+		_matrix.elements[0][0], _matrix.elements[0][1], _matrix.elements[0][2],
+		_matrix.elements[1][0], _matrix.elements[1][1], _matrix.elements[1][2]
+	);
+
+	return Status::SUCCESS;
+}
+
+using Matrix3x3f = Matrix3x3<float>;
+using Matrix3x3d = Matrix3x3<double>;
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MATH_MATRIX3X3
\ No newline at end of file
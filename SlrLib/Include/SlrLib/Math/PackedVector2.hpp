@@ -0,0 +1,568 @@
+#pragma once
+#ifndef SLR_MATH_PACKEDVECTOR2
+#define SLR_MATH_PACKEDVECTOR2
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <span>
+
+#include "SlrLib/Containers/DynamicArray.hpp"
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/Simd.hpp"
+#include "SlrLib/Math/AABB2.hpp"
+#include "SlrLib/Math/Vector2.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* A Vector2<float> stored as two IEEE 754 half precision floats, in 4 bytes
+* Refer to EncodeHalf(...) for the error of the conversion
+*/
+struct HalfVector2
+{
+	/**
+	* The bits of the x component
+	*/
+	u16 x = 0;
+
+	/**
+	* The bits of the y component
+	*/
+	u16 y = 0;
+
+	constexpr bool operator==(const HalfVector2& _rhs) const { return x == _rhs.x && y == _rhs.y; }
+
+	constexpr bool operator!=(const HalfVector2& _rhs) const { return !(*this == _rhs); }
+};
+
+/**
+* A Vector2<float> stored as two 16-bit fixed point values within the bounds of a Vector2Quantizer, in 4 bytes
+* A value of 0 is the minimum of the bounds and 65535 is the maximum
+*/
+struct QuantizedVector2
+{
+	u16 x = 0;
+
+	u16 y = 0;
+
+	constexpr bool operator==(const QuantizedVector2& _rhs) const { return x == _rhs.x && y == _rhs.y; }
+
+	constexpr bool operator!=(const QuantizedVector2& _rhs) const { return !(*this == _rhs); }
+};
+
+/**
+* Shared implementation of the packed vector conversions
+* This class is purely to hide the implementation from the user to make it clear not to interact with anything contained
+* within it
+*/
+class PackedVector2Implementation
+{
+public:
+	/**
+	* Converts a float to half precision, rounding to the nearest value with ties to even
+	* This gives the same result as F16C: values from 65520 upwards become infinity and NaN stays NaN
+	*/
+	static inline u16 FloatToHalf(const float _value)
+	{
+		const u32 bits = std::bit_cast<u32>(_value);
+		const u32 sign = (bits >> 16) & 0x8000;
+		u32 magnitude = bits & 0x7FFFFFFF;
+
+		// Infinity and NaN, where NaN is made quiet and keeps the upper bits of its payload
+		if (magnitude >= 0x7F800000)
+		{
+			return static_cast<u16>(sign | (magnitude > 0x7F800000 ? 0x7E00 | ((magnitude >> 13) & 0x3FF) : 0x7C00));
+		}
+
+		// Too large for half precision, which includes values rounding up to 65536
+		if (magnitude >= 0x477FF000)
+		{
+			return static_cast<u16>(sign | 0x7C00);
+		}
+
+		// Below the smallest normal half, adding 0.5 lines the half's subnormal bits up with the bottom of the float's
+		// mantissa and lets the addition round them
+		if (magnitude < 0x38800000)
+		{
+			const float shifted = std::bit_cast<float>(magnitude) + 0.5f;
+
+			return static_cast<u16>(sign | (std::bit_cast<u32>(shifted) - 0x3F000000));
+		}
+
+		// Rebias the exponent and round away the lower 13 bits of the mantissa, with ties going to the even result
+		const u32 isOdd = (magnitude >> 13) & 1;
+		magnitude += 0xC8000FFF + isOdd;
+
+		return static_cast<u16>(sign | (magnitude >> 13));
+	}
+
+	/**
+	* Converts a half precision float to a float, which is exact for every value other than NaN
+	*/
+	static inline float HalfToFloat(const u16 _value)
+	{
+		constexpr u32 exponentMask = 0x7C00 << 13;
+
+		u32 bits = (_value & 0x7FFF) << 13;
+		const u32 exponent = bits & exponentMask;
+
+		// Rebias the exponent
+		bits += (127 - 15) << 23;
+
+		if (exponent == exponentMask)
+		{
+			// Infinity and NaN keep the maximum exponent, and NaN is made quiet as by F16C
+			bits += (128 - 16) << 23;
+
+			if ((_value & 0x3FF) != 0)
+			{
+				bits |= 0x400000;
+			}
+		}
+		else if (exponent == 0)
+		{
+			// Subnormals are renormalized by the subtraction
+			bits += 1 << 23;
+			bits = std::bit_cast<u32>(std::bit_cast<float>(bits) - std::bit_cast<float>(113u << 23));
+		}
+
+		return std::bit_cast<float>(bits | ((_value & 0x8000u) << 16));
+	}
+
+	/**
+	* Converts _count floats to half precision
+	*/
+	static void EncodeHalf(u16* _result, const float* _values, const size _count)
+	{
+		size i = 0;
+
+#if defined(SLR_SIMD_F16C) && defined(SLR_SIMD_AVX)
+		for (; i + 8 <= _count; i += 8)
+		{
+			const __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(_values + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(_result + i), halves);
+		}
+#endif
+
+		for (; i < _count; ++i)
+		{
+			_result[i] = FloatToHalf(_values[i]);
+		}
+	}
+
+	/**
+	* Converts _count half precision floats to floats
+	*/
+	static void DecodeHalf(float* _result, const u16* _values, const size _count)
+	{
+		size i = 0;
+
+#if defined(SLR_SIMD_F16C) && defined(SLR_SIMD_AVX)
+		for (; i + 8 <= _count; i += 8)
+		{
+			_mm256_storeu_ps(_result + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_values + i))));
+		}
+#endif
+
+		for (; i < _count; ++i)
+		{
+			_result[i] = HalfToFloat(_values[i]);
+		}
+	}
+
+	/**
+	* Quantizes _count interleaved x and y components, where _offset and _scale hold the values for x then y
+	* The scaled value is clamped before rounding, so NaN becomes 0
+	*/
+	static void Quantize(u16* _result, const float* _values, const size _count, const float (&_offset)[2], const float (&_scale)[2])
+	{
+		size i = 0;
+
+#ifdef SLR_SIMD_AVX2
+		const __m256 offset = _mm256_setr_ps(_offset[0], _offset[1], _offset[0], _offset[1], _offset[0], _offset[1], _offset[0], _offset[1]);
+		const __m256 scale = _mm256_setr_ps(_scale[0], _scale[1], _scale[0], _scale[1], _scale[0], _scale[1], _scale[0], _scale[1]);
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 maximum = _mm256_set1_ps(65535.0f);
+
+		// Each iteration converts two registers of floats, which pack into one register of 16-bit values
+		for (; i + 16 <= _count; i += 16)
+		{
+			__m256 first = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(_values + i), offset), scale);
+			__m256 second = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(_values + i + 8), offset), scale);
+
+			// maxps returns its second operand when either is NaN
+			first = _mm256_min_ps(_mm256_max_ps(first, zero), maximum);
+			second = _mm256_min_ps(_mm256_max_ps(second, zero), maximum);
+
+			// packus interleaves the 128 bit halves of its inputs, so put them back in order
+			const __m256i packed = _mm256_packus_epi32(_mm256_cvtps_epi32(first), _mm256_cvtps_epi32(second));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(_result + i), _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+		}
+#endif
+
+		for (; i < _count; ++i)
+		{
+			float value = (_values[i] - _offset[i & 1]) * _scale[i & 1];
+
+			value = value > 0.0f ? value : 0.0f;
+			value = value < 65535.0f ? value : 65535.0f;
+
+			_result[i] = static_cast<u16>(std::nearbyint(value));
+		}
+	}
+
+	/**
+	* Dequantizes _count interleaved x and y components, where _offset and _step hold the values for x then y
+	* FMA is deliberately not used so that the AVX2 results match the scalar loop, provided the compiler doesn't contract
+	* either into FMA; refer to Decode(...) for a batch of vectors
+	*/
+	static void Dequantize(float* _result, const u16* _values, const size _count, const float (&_offset)[2], const float (&_step)[2])
+	{
+		size i = 0;
+
+#ifdef SLR_SIMD_AVX2
+		const __m256 offset = _mm256_setr_ps(_offset[0], _offset[1], _offset[0], _offset[1], _offset[0], _offset[1], _offset[0], _offset[1]);
+		const __m256 step = _mm256_setr_ps(_step[0], _step[1], _step[0], _step[1], _step[0], _step[1], _step[0], _step[1]);
+
+		for (; i + 8 <= _count; i += 8)
+		{
+			const __m256i values = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_values + i)));
+
+			// Kept as a separate multiply and add, rather than a fused multiply-add, so the results match the scalar code
+			_mm256_storeu_ps(_result + i, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(values), step), offset));
+		}
+#endif
+
+		for (; i < _count; ++i)
+		{
+			_result[i] = (static_cast<float>(_values[i]) * _step[i & 1]) + _offset[i & 1];
+		}
+	}
+
+	/**
+	* Returns the components of an array of vectors as a flat array of x, y, x, y, ...
+	*/
+	template<typename _Vector, typename _Component>
+	static inline _Component* GetComponents(const std::span<_Vector> _vectors)
+	{
+		static_assert(sizeof(_Vector) == 2 * sizeof(_Component), "Packed vectors must not contain any padding");
+
+		return reinterpret_cast<_Component*>(_vectors.data());
+	}
+};
+
+/**
+* Converts a vector to half precision
+* Each component is rounded to the nearest half precision value. For magnitudes within [2^-14, 65504] the relative error is
+* at most 2^-11 (about 4.9e-4); below 2^-14 the absolute error is at most 2^-25 (about 3e-8). Magnitudes from 65520
+* upwards become infinity.
+*/
+inline Status EncodeHalf(SLR_RETURN(HalfVector2) _result, const Vector2<float>& _value)
+{
+	_result.x = PackedVector2Implementation::FloatToHalf(_value.x);
+	_result.y = PackedVector2Implementation::FloatToHalf(_value.y);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Converts a vector from half precision, which is always exact
+*/
+inline Status DecodeHalf(SLR_RETURN(Vector2<float>) _result, const HalfVector2& _value)
+{
+	_result = Vector2<float>(
+		PackedVector2Implementation::HalfToFloat(_value.x),
+		PackedVector2Implementation::HalfToFloat(_value.y)
+	);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Converts each vector of _values to half precision, using F16C when it is available
+* The results are identical to those of EncodeHalf(...) for a single vector
+*/
+inline Status EncodeHalf(const std::span<HalfVector2> _result, const std::span<const Vector2<float>> _values)
+{
+	SLR_ASSERT_ERROR(_values.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	PackedVector2Implementation::EncodeHalf(
+		PackedVector2Implementation::GetComponents<HalfVector2, u16>(_result),
+		PackedVector2Implementation::GetComponents<const Vector2<float>, const float>(_values),
+		2 * _values.size()
+	);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Converts each vector of _values from half precision, using F16C when it is available
+*/
+inline Status DecodeHalf(const std::span<Vector2<float>> _result, const std::span<const HalfVector2> _values)
+{
+	SLR_ASSERT_ERROR(_values.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	PackedVector2Implementation::DecodeHalf(
+		PackedVector2Implementation::GetComponents<Vector2<float>, float>(_result),
+		PackedVector2Implementation::GetComponents<const HalfVector2, const u16>(_values),
+		2 * _values.size()
+	);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Replaces the contents of _result with each vector of _values converted to half precision
+*/
+inline Status EncodeHalf(SLR_RETURN(DynamicArray<HalfVector2>) _result, const DynamicArray<Vector2<float>>& _values)
+{
+	std::span<const Vector2<float>> values;
+	_values.GetSpan(values);
+
+	Status resizeStatus = _result.Resize(values.size());
+	SLR_ASSERT_ERROR(resizeStatus == Status::SUCCESS, "Could not resize the packed array")
+	{
+		return Status::FAIL;
+	}
+
+	std::span<HalfVector2> result;
+	_result.GetSpan(result);
+
+	return EncodeHalf(result, values);
+}
+
+/**
+* Replaces the contents of _result with each vector of _values converted from half precision
+*/
+inline Status DecodeHalf(SLR_RETURN(DynamicArray<Vector2<float>>) _result, const DynamicArray<HalfVector2>& _values)
+{
+	std::span<const HalfVector2> values;
+	_values.GetSpan(values);
+
+	Status resizeStatus = _result.Resize(values.size());
+	SLR_ASSERT_ERROR(resizeStatus == Status::SUCCESS, "Could not resize the vector array")
+	{
+		return Status::FAIL;
+	}
+
+	std::span<Vector2<float>> result;
+	_result.GetSpan(result);
+
+	return DecodeHalf(result, values);
+}
+
+/**
+* Converts vectors to and from 16-bit fixed point within a bounding box
+* Each axis of the box is divided into 65535 equal steps. A vector within the box is decoded with an error of at most half
+* a step on each axis, (maximum - minimum) / 131070, plus the rounding of a float at the magnitude of the bounds. Vectors
+* outside of the box are clamped to it, and NaN components become the minimum of the box.
+* Quantizing the positions of a 1 km box gives a precision of about 7.6 mm.
+*/
+class Vector2Quantizer
+{
+public:
+	/**
+	* Default constructor
+	* The bounds are the unit square, from (0, 0) to (1, 1)
+	*/
+	Vector2Quantizer()
+	{
+		Reset(AABB2<float>(Vector2<float>(0.0f, 0.0f), Vector2<float>(1.0f, 1.0f)));
+	}
+
+	/**
+	* Constructor
+	* Takes the bounds to quantize within; refer to Reset(...)
+	*/
+	explicit Vector2Quantizer(const AABB2<float>& _bounds)
+	{
+		Reset(_bounds);
+	}
+
+	/**
+	* Sets the bounds to quantize within
+	* Fails, leaving the previous bounds, if the bounds are not finite or have zero width or height
+	*/
+	Status Reset(const AABB2<float>& _bounds)
+	{
+		const float width = _bounds.maximum.x - _bounds.minimum.x;
+		const float height = _bounds.maximum.y - _bounds.minimum.y;
+
+		SLR_ASSERT_ERROR(width > 0.0f && height > 0.0f, "Quantization bounds must have a positive width and height")
+		{
+			return Status::FAIL;
+		}
+
+		SLR_ASSERT_ERROR(width <= std::numeric_limits<float>::max() && height <= std::numeric_limits<float>::max(), "Quantization bounds must be finite")
+		{
+			return Status::FAIL;
+		}
+
+		bounds = _bounds;
+
+		offset[0] = _bounds.minimum.x;
+		offset[1] = _bounds.minimum.y;
+
+		scale[0] = 65535.0f / width;
+		scale[1] = 65535.0f / height;
+
+		step[0] = width / 65535.0f;
+		step[1] = height / 65535.0f;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the bounds which are quantized within
+	*/
+	inline Status GetBounds(SLR_RETURN(AABB2<float>) _bounds) const
+	{
+		_bounds = bounds;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the distance between neighbouring quantized values on each axis
+	* The error of a vector within the bounds is at most half of this, plus float rounding
+	*/
+	inline Status GetStep(SLR_RETURN(Vector2<float>) _step) const
+	{
+		_step = Vector2<float>(step[0], step[1]);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Quantizes a vector, clamping it to the bounds
+	*/
+	inline Status Encode(SLR_RETURN(QuantizedVector2) _result, const Vector2<float>& _value) const
+	{
+		PackedVector2Implementation::Quantize(&_result.x, &_value.x, 2, offset, scale);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Dequantizes a vector
+	*/
+	inline Status Decode(SLR_RETURN(Vector2<float>) _result, const QuantizedVector2& _value) const
+	{
+		PackedVector2Implementation::Dequantize(&_result.x, &_value.x, 2, offset, step);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Quantizes each vector of _values, using AVX2 when it is available
+	* The results are identical to those of Encode(...) for a single vector
+	*/
+	Status Encode(const std::span<QuantizedVector2> _result, const std::span<const Vector2<float>> _values) const
+	{
+		SLR_ASSERT_ERROR(_values.size() == _result.size(), "Batch arrays must be the same size")
+		{
+			return Status::FAIL;
+		}
+
+		PackedVector2Implementation::Quantize(
+			PackedVector2Implementation::GetComponents<QuantizedVector2, u16>(_result),
+			PackedVector2Implementation::GetComponents<const Vector2<float>, const float>(_values),
+			2 * _values.size(),
+			offset,
+			scale
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Dequantizes each vector of _values, using AVX2 when it is available
+	* The results are identical to those of Decode(...) for a single vector only if the compiler doesn't contract `a * b + c`
+	* into a fused multiply-add, which is the default for MSVC and requires -ffp-contract=off with GCC and Clang when FMA
+	* instructions are enabled; GCC contracts the intrinsics as well as the scalar expression. Otherwise either may be
+	* fused, rounding once instead of twice, and the results may differ in the low bits, or further where the offset cancels
+	* out the scaled value.
+	*/
+	Status Decode(const std::span<Vector2<float>> _result, const std::span<const QuantizedVector2> _values) const
+	{
+		SLR_ASSERT_ERROR(_values.size() == _result.size(), "Batch arrays must be the same size")
+		{
+			return Status::FAIL;
+		}
+
+		PackedVector2Implementation::Dequantize(
+			PackedVector2Implementation::GetComponents<Vector2<float>, float>(_result),
+			PackedVector2Implementation::GetComponents<const QuantizedVector2, const u16>(_values),
+			2 * _values.size(),
+			offset,
+			step
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Replaces the contents of _result with each vector of _values quantized
+	*/
+	Status Encode(SLR_RETURN(DynamicArray<QuantizedVector2>) _result, const DynamicArray<Vector2<float>>& _values) const
+	{
+		std::span<const Vector2<float>> values;
+		_values.GetSpan(values);
+
+		Status resizeStatus = _result.Resize(values.size());
+		SLR_ASSERT_ERROR(resizeStatus == Status::SUCCESS, "Could not resize the quantized array")
+		{
+			return Status::FAIL;
+		}
+
+		std::span<QuantizedVector2> result;
+		_result.GetSpan(result);
+
+		return Encode(result, values);
+	}
+
+	/**
+	* Replaces the contents of _result with each vector of _values dequantized
+	*/
+	Status Decode(SLR_RETURN(DynamicArray<Vector2<float>>) _result, const DynamicArray<QuantizedVector2>& _values) const
+	{
+		std::span<const QuantizedVector2> values;
+		_values.GetSpan(values);
+
+		Status resizeStatus = _result.Resize(values.size());
+		SLR_ASSERT_ERROR(resizeStatus == Status::SUCCESS, "Could not resize the vector array")
+		{
+			return Status::FAIL;
+		}
+
+		std::span<Vector2<float>> result;
+		_result.GetSpan(result);
+
+		return Decode(result, values);
+	}
+
+private:
+	AABB2<float> bounds;
+
+	/**
+	* The minimum, scale and step of each axis, in the order x then y to match interleaved components
+	*/
+	float offset[2] = {};
+	float scale[2] = {};
+	float step[2] = {};
+};
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MATH_PACKEDVECTOR2
\ No newline at end of file
@@ -0,0 +1,618 @@
+#pragma once
+#ifndef SLR_MATH_RANDOM
+#define SLR_MATH_RANDOM
+
+#include <bit>
+#include <span>
+#include <type_traits>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/SimdRandom.hpp"
+#include "SlrLib/Math/Vector2.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* Shared implementation of the random number generators
+* This class is purely to hide the implementation from the user to make it clear not to interact with anything contained
+* within it
+*/
+class RandomImplementation
+{
+public:
+	static constexpr u64 RotateLeft(const u64 _value, const int _shift)
+	{
+		return (_value << _shift) | (_value >> (64 - _shift));
+	}
+
+	/**
+	* Steps a SplitMix64 generator, which is used to expand a single seed into a full generator state
+	*/
+	static constexpr u64 SplitMix64(u64& _state)
+	{
+		_state += 0x9E3779B97F4A7C15;
+
+		u64 value = _state;
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+
+		return value ^ (value >> 31);
+	}
+
+	/**
+	* Converts the upper 24 bits of a value into a float in [0, 1)
+	*/
+	static constexpr float ToFloat(const u32 _bits)
+	{
+		return static_cast<float>(_bits >> 8) * 0x1.0p-24f;
+	}
+
+	/**
+	* Converts the upper 52 bits of a value into a double in [0, 1)
+	* The bits form the mantissa of a double in [1, 2), from which one is subtracted; this matches the SIMD conversion
+	*/
+	static constexpr double ToDouble(const u64 _bits)
+	{
+		return std::bit_cast<double>((_bits >> 12) | 0x3FF0000000000000) - 1.0;
+	}
+};
+
+/**
+* The operations shared by every random number generator
+* _Generator must provide Generate32() and Generate64(), returning uniformly distributed bits. A generator may provide
+* faster versions of Fill(...), which are then used by FillSquare(...).
+* Floats are multiples of 2^-24 and doubles are multiples of 2^-52, both within [0, 1).
+*/
+template<typename _Generator>
+class RandomGenerator
+{
+public:
+	/**
+	* Returns uniformly distributed bits
+	*/
+	inline Status Next(SLR_RETURN(u32) _value)
+	{
+		_value = GetGenerator().Generate32();
+
+		return Status::SUCCESS;
+	}
+
+	inline Status Next(SLR_RETURN(u64) _value)
+	{
+		_value = GetGenerator().Generate64();
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a value uniformly distributed within [0, 1)
+	*/
+	inline Status Next(SLR_RETURN(float) _value)
+	{
+		_value = RandomImplementation::ToFloat(GetGenerator().Generate32());
+
+		return Status::SUCCESS;
+	}
+
+	inline Status Next(SLR_RETURN(double) _value)
+	{
+		_value = RandomImplementation::ToDouble(GetGenerator().Generate64());
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a vector uniformly distributed within the unit square, [0, 1) on both axes
+	*/
+	template<typename _Type>
+	inline Status NextInSquare(SLR_RETURN(Vector2<_Type>) _vector)
+	{
+		static_assert(std::is_floating_point<_Type>::value, "Random vectors must be floating point");
+
+		Next(_vector.x);
+		Next(_vector.y);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a vector uniformly distributed within the unit disk, centered on the origin
+	* Points are drawn from the enclosing square until one lands within the disk, which takes 1.27 attempts on average
+	*/
+	template<typename _Type>
+	inline Status NextInDisk(SLR_RETURN(Vector2<_Type>) _vector)
+	{
+		static_assert(std::is_floating_point<_Type>::value, "Random vectors must be floating point");
+
+		_Type x;
+		_Type y;
+
+		do
+		{
+			Next(x);
+			Next(y);
+
+			x = (2 * x) - 1;
+			y = (2 * y) - 1;
+		}
+		while ((x * x) + (y * y) >= 1);
+
+		_vector = Vector2<_Type>(x, y);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Fills an array with uniformly distributed bits
+	*/
+	Status Fill(const std::span<u32> _values)
+	{
+		for (u32& value : _values)
+		{
+			value = GetGenerator().Generate32();
+		}
+
+		return Status::SUCCESS;
+	}
+
+	Status Fill(const std::span<u64> _values)
+	{
+		for (u64& value : _values)
+		{
+			value = GetGenerator().Generate64();
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Fills an array with values uniformly distributed within [0, 1)
+	*/
+	Status Fill(const std::span<float> _values)
+	{
+		for (float& value : _values)
+		{
+			value = RandomImplementation::ToFloat(GetGenerator().Generate32());
+		}
+
+		return Status::SUCCESS;
+	}
+
+	Status Fill(const std::span<double> _values)
+	{
+		for (double& value : _values)
+		{
+			value = RandomImplementation::ToDouble(GetGenerator().Generate64());
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Fills an array with vectors uniformly distributed within the unit square
+	*/
+	template<typename _Type>
+	Status FillSquare(const std::span<Vector2<_Type>> _vectors)
+	{
+		static_assert(std::is_floating_point<_Type>::value, "Random vectors must be floating point");
+		static_assert(sizeof(Vector2<_Type>) == 2 * sizeof(_Type), "Vector2 must not contain any padding");
+
+		// Every component is independent, so the vectors can be filled as a flat array
+		return GetGenerator().Fill(std::span<_Type>(reinterpret_cast<_Type*>(_vectors.data()), 2 * _vectors.size()));
+	}
+
+	/**
+	* Fills an array with vectors uniformly distributed within the unit disk
+	*/
+	template<typename _Type>
+	Status FillDisk(const std::span<Vector2<_Type>> _vectors)
+	{
+		for (Vector2<_Type>& vector : _vectors)
+		{
+			NextInDisk<_Type>(vector);
+		}
+
+		return Status::SUCCESS;
+	}
+
+private:
+	inline _Generator& GetGenerator() { return static_cast<_Generator&>(*this); }
+};
+
+/**
+* The xoshiro256** generator by David Blackman and Sebastiano Vigna
+* It has a period of 2^256 - 1 and passes all common statistical tests. It is not suitable for cryptography.
+* Independent streams for other threads are made with Split(...), which hands over the next 2^128 values of this
+* generator's sequence, so streams split from the same generator never overlap.
+*/
+class Xoshiro256StarStar : public RandomGenerator<Xoshiro256StarStar>
+{
+	friend class RandomGenerator<Xoshiro256StarStar>;
+	friend class Xoshiro256StarStarX4;
+
+public:
+	/**
+	* Constructor
+	* Expands _seed into the full state with SplitMix64, so similar seeds still produce unrelated sequences
+	*/
+	explicit constexpr Xoshiro256StarStar(u64 _seed = 0) : state{}
+	{
+		for (u64& word : state)
+		{
+			word = RandomImplementation::SplitMix64(_seed);
+		}
+	}
+
+	/**
+	* Advances the generator by 2^128 values
+	*/
+	constexpr Status Jump()
+	{
+		constexpr u64 polynomial[] = { 0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C };
+
+		ApplyJump(polynomial);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Advances the generator by 2^192 values
+	* This can be used to create up to 2^64 starting points, each of which can then be split by Jump()
+	*/
+	constexpr Status LongJump()
+	{
+		constexpr u64 polynomial[] = { 0x76E15D3EFEFDCBBF, 0xC5004E441C522FB3, 0x77710069854EE241, 0x39109BB02ACBE635 };
+
+		ApplyJump(polynomial);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a generator which produces the next 2^128 values of this generator's sequence, then jumps past them
+	*/
+	constexpr Status Split(SLR_RETURN(Xoshiro256StarStar) _stream)
+	{
+		_stream = *this;
+
+		return Jump();
+	}
+
+private:
+	u64 state[4];
+
+	constexpr u64 Generate64()
+	{
+		const u64 result = RandomImplementation::RotateLeft(state[1] * 5, 7) * 9;
+		const u64 shifted = state[1] << 17;
+
+		state[2] ^= state[0];
+		state[3] ^= state[1];
+		state[1] ^= state[2];
+		state[0] ^= state[3];
+		state[2] ^= shifted;
+		state[3] = RandomImplementation::RotateLeft(state[3], 45);
+
+		return result;
+	}
+
+	/**
+	* The lower bits of xoshiro256** are its weakest, so the upper bits are used
+	*/
+	constexpr u32 Generate32() { return static_cast<u32>(Generate64() >> 32); }
+
+	constexpr void ApplyJump(const u64 (&_polynomial)[4])
+	{
+		u64 jumped[4] = {};
+
+		for (const u64 word : _polynomial)
+		{
+			for (u32 bit = 0; bit < 64; ++bit)
+			{
+				if (word & (u64(1) << bit))
+				{
+					for (u32 i = 0; i < 4; ++i)
+					{
+						jumped[i] ^= state[i];
+					}
+				}
+
+				Generate64();
+			}
+		}
+
+		for (u32 i = 0; i < 4; ++i)
+		{
+			state[i] = jumped[i];
+		}
+	}
+};
+
+/**
+* Four xoshiro256** generators which are stepped together, allowing arrays to be filled four values at a time with AVX2
+* The generators are made from a single seed by jumping, so their sequences do not overlap. Values are produced from each
+* generator in turn. The sequence is the same whether or not AVX2 is available, but it differs from that of a single
+* Xoshiro256StarStar with the same seed.
+*/
+class Xoshiro256StarStarX4 : public RandomGenerator<Xoshiro256StarStarX4>
+{
+	friend class RandomGenerator<Xoshiro256StarStarX4>;
+
+public:
+	/**
+	* Constructor
+	* The first generator is seeded with _seed, and each other generator starts 2^128 values after the one before it
+	*/
+	explicit constexpr Xoshiro256StarStarX4(const u64 _seed = 0) : state{}, buffer{}
+	{
+		Xoshiro256StarStar generator(_seed);
+
+		for (u32 lane = 0; lane < 4; ++lane)
+		{
+			for (u32 word = 0; word < 4; ++word)
+			{
+				state[word][lane] = generator.state[word];
+			}
+
+			generator.Jump();
+		}
+	}
+
+	/**
+	* Advances every generator by 2^192 values
+	* Every generator starts 2^128 values after the last, so a long jump keeps them from overlapping with those of another
+	* Xoshiro256StarStarX4 made from the same seed
+	*/
+	Status LongJump()
+	{
+		for (u32 lane = 0; lane < 4; ++lane)
+		{
+			Xoshiro256StarStar generator;
+			ReadLane(generator, lane);
+
+			generator.LongJump();
+			WriteLane(generator, lane);
+		}
+
+		bufferedCount = 0;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Fills an array with uniformly distributed bits
+	*/
+	Status Fill(const std::span<u64> _values)
+	{
+		FillWith<SimdXoshiro256StarStar>(_values);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Fills an array with uniformly distributed bits, taken from the upper half of each generated value
+	*/
+	Status Fill(const std::span<u32> _values)
+	{
+		FillWith<SimdXoshiro256StarStar>(_values);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Fills an array with values uniformly distributed within [0, 1)
+	*/
+	Status Fill(const std::span<float> _values)
+	{
+		FillWith<SimdXoshiro256StarStar>(_values);
+
+		return Status::SUCCESS;
+	}
+
+	Status Fill(const std::span<double> _values)
+	{
+		FillWith<SimdXoshiro256StarStar>(_values);
+
+		return Status::SUCCESS;
+	}
+
+private:
+	/**
+	* The state of the generators, where state[word][lane] is a word of the state of one generator
+	*/
+	u64 state[4][4];
+
+	/**
+	* The values of the last step which have not yet been returned, which are used from buffer[4 - bufferedCount] onwards
+	*/
+	u64 buffer[4];
+
+	u32 bufferedCount = 0;
+
+	inline void ReadLane(Xoshiro256StarStar& _generator, const u32 _lane) const
+	{
+		for (u32 word = 0; word < 4; ++word)
+		{
+			_generator.state[word] = state[word][_lane];
+		}
+	}
+
+	inline void WriteLane(const Xoshiro256StarStar& _generator, const u32 _lane)
+	{
+		for (u32 word = 0; word < 4; ++word)
+		{
+			state[word][_lane] = _generator.state[word];
+		}
+	}
+
+	/**
+	* Steps every generator without SIMD, writing the value of each to _results
+	*/
+	inline void Step(u64 (&_results)[4])
+	{
+		for (u32 lane = 0; lane < 4; ++lane)
+		{
+			_results[lane] = RandomImplementation::RotateLeft(state[1][lane] * 5, 7) * 9;
+
+			const u64 shifted = state[1][lane] << 17;
+
+			state[2][lane] ^= state[0][lane];
+			state[3][lane] ^= state[1][lane];
+			state[1][lane] ^= state[2][lane];
+			state[0][lane] ^= state[3][lane];
+			state[2][lane] ^= shifted;
+			state[3][lane] = RandomImplementation::RotateLeft(state[3][lane], 45);
+		}
+	}
+
+	inline u64 Generate64()
+	{
+		if (bufferedCount == 0)
+		{
+			Step(buffer);
+			bufferedCount = 4;
+		}
+
+		return buffer[4 - bufferedCount--];
+	}
+
+	inline u32 Generate32() { return static_cast<u32>(Generate64() >> 32); }
+
+	/**
+	* Fills _values, converting each generated value in the same way as the scalar Fill(...)
+	*/
+	template<typename _Simd, typename _Type>
+	void FillWith(const std::span<_Type> _values)
+	{
+		size i = 0;
+
+		// Use up the values left over from an earlier call first, so that the sequence does not depend on how it is read
+		for (; i < _values.size() && bufferedCount > 0; ++i)
+		{
+			RandomGenerator::Fill(_values.subspan(i, 1));
+		}
+
+		if constexpr (_Simd::isEnabled)
+		{
+			if (i + 4 <= _values.size())
+			{
+				typename _Simd::Register s0 = _Simd::Load(state[0]);
+				typename _Simd::Register s1 = _Simd::Load(state[1]);
+				typename _Simd::Register s2 = _Simd::Load(state[2]);
+				typename _Simd::Register s3 = _Simd::Load(state[3]);
+
+				for (; i + 4 <= _values.size(); i += 4)
+				{
+					_Simd::Store(_values.data() + i, _Simd::Next(s0, s1, s2, s3));
+				}
+
+				_Simd::Store(state[0], s0);
+				_Simd::Store(state[1], s1);
+				_Simd::Store(state[2], s2);
+				_Simd::Store(state[3], s3);
+			}
+		}
+
+		RandomGenerator::Fill(_values.subspan(i));
+	}
+};
+
+/**
+* The PCG32 generator (XSH RR variant) by Melissa O'Neill
+* It has a period of 2^64 for each of 2^63 selectable streams, with a small state. It is not suitable for cryptography.
+* Generators with different streams produce unrelated sequences even with the same seed, so independent streams for other
+* threads are made by selecting a different stream, or with Split(...).
+*/
+class Pcg32 : public RandomGenerator<Pcg32>
+{
+	friend class RandomGenerator<Pcg32>;
+
+public:
+	/**
+	* Constructor
+	* Only the lower 63 bits of _stream are used
+	*/
+	explicit constexpr Pcg32(const u64 _seed = 0, const u64 _stream = 0) : state(0), increment((_stream << 1) | 1)
+	{
+		Generate32();
+		state += _seed;
+		Generate32();
+	}
+
+	/**
+	* Advances the generator by _delta values in O(log(_delta)) time
+	* The generator can be moved backwards by passing the two's complement of the distance
+	*/
+	constexpr Status Advance(u64 _delta)
+	{
+		u64 multiplier = 6364136223846793005;
+		u64 increment = this->increment;
+
+		u64 accumulatedMultiplier = 1;
+		u64 accumulatedIncrement = 0;
+
+		// Compose the step with itself by squaring, applying it for each set bit of _delta
+		while (_delta > 0)
+		{
+			if (_delta & 1)
+			{
+				accumulatedMultiplier *= multiplier;
+				accumulatedIncrement = (accumulatedIncrement * multiplier) + increment;
+			}
+
+			increment = (multiplier + 1) * increment;
+			multiplier *= multiplier;
+			_delta >>= 1;
+		}
+
+		state = (accumulatedMultiplier * state) + accumulatedIncrement;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a generator on a new stream, seeded from this generator
+	*/
+	constexpr Status Split(SLR_RETURN(Pcg32) _stream)
+	{
+		const u64 seed = Generate64();
+		const u64 stream = Generate64();
+
+		_stream = Pcg32(seed, stream);
+
+		return Status::SUCCESS;
+	}
+
+private:
+	u64 state;
+
+	/**
+	* The increment of the underlying linear congruential generator, which selects the stream; this is always odd
+	*/
+	u64 increment;
+
+	constexpr u32 Generate32()
+	{
+		const u64 previous = state;
+
+		state = (previous * 6364136223846793005) + increment;
+
+		const u32 shifted = static_cast<u32>(((previous >> 18) ^ previous) >> 27);
+		const u32 rotation = static_cast<u32>(previous >> 59);
+
+		return (shifted >> rotation) | (shifted << ((0u - rotation) & 31));
+	}
+
+	constexpr u64 Generate64()
+	{
+		const u64 upper = Generate32();
+
+		return (upper << 32) | Generate32();
+	}
+};
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MATH_RANDOM
\ No newline at end of file
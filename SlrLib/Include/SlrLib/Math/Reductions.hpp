@@ -0,0 +1,724 @@
+#pragma once
+#ifndef SLR_MATH_REDUCTIONS
+#define SLR_MATH_REDUCTIONS
+
+#include <bit>
+#include <span>
+#include <type_traits>
+
+#include "SlrLib/Containers/DynamicArray.hpp"
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/SimdBatch.hpp"
+#include "SlrLib/Math/Functions.hpp"
+#include "SlrLib/Math/Vector2.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* Shared implementation of the reductions
+* This class is purely to hide the implementation from the user to make it clear not to interact with anything contained
+* within it
+*/
+class ReductionImplementation
+{
+public:
+	/**
+	* The operation used to combine two values
+	*/
+	enum class Operation : word
+	{
+		SUM,
+		MINIMUM,
+		MAXIMUM
+	};
+
+	/**
+	* Combines two values with _Operation
+	* The minimum and maximum are calculated in the same way as Min(...) and Max(...)
+	*/
+	template<Operation _Operation, typename _Type>
+	static constexpr _Type Combine(const _Type _left, const _Type _right)
+	{
+		if constexpr (_Operation == Operation::SUM)
+		{
+			return _left + _right;
+		}
+		else if constexpr (_Operation == Operation::MINIMUM)
+		{
+			return _left < _right ? _left : _right;
+		}
+		else
+		{
+			return _left < _right ? _right : _left;
+		}
+	}
+
+	/**
+	* Combines two registers with _Operation
+	*/
+	template<Operation _Operation, typename _Simd, typename _Register>
+	static inline _Register CombineRegisters(const _Register _left, const _Register _right)
+	{
+		if constexpr (_Operation == Operation::SUM)
+		{
+			return _Simd::Add(_left, _right);
+		}
+		else if constexpr (_Operation == Operation::MINIMUM)
+		{
+			return _Simd::Minimum(_left, _right);
+		}
+		else
+		{
+			return _Simd::Maximum(_left, _right);
+		}
+	}
+
+	/**
+	* Reduces _count values with _Operation into _Stride results, where value i is combined into result i % _Stride
+	* A stride of 2 reduces the x and y components of interleaved vectors separately. _count must be a multiple of _Stride.
+	* For sums, _result is set to 0; for the minimum and maximum, _count must not be 0.
+	*/
+	template<Operation _Operation, size _Stride, typename _Type>
+	static void Reduce(_Type (&_result)[_Stride], const _Type* _values, const size _count)
+	{
+		size i = 0;
+
+		if constexpr (SimdBatch<_Type>::isEnabled)
+		{
+			using Simd = SimdBatch<_Type>;
+			using Register = typename Simd::Register;
+
+			static_assert(Simd::width % _Stride == 0, "Stride must divide the width of the register");
+
+			if (_count >= Simd::width)
+			{
+				// The minimum and maximum start from the first values, as combining a value with itself has no effect
+				const Register first = _Operation == Operation::SUM ? Simd::Zero() : Simd::Load(_values);
+
+				// Four independent accumulators hide the latency of each operation
+				Register accumulators[4] = { first, first, first, first };
+
+				for (; i + 4 * Simd::width <= _count; i += 4 * Simd::width)
+				{
+					for (size accumulator = 0; accumulator < 4; ++accumulator)
+					{
+						const Register values = Simd::Load(_values + i + accumulator * Simd::width);
+
+						accumulators[accumulator] = CombineRegisters<_Operation, Simd>(accumulators[accumulator], values);
+					}
+				}
+
+				for (; i + Simd::width <= _count; i += Simd::width)
+				{
+					accumulators[0] = CombineRegisters<_Operation, Simd>(accumulators[0], Simd::Load(_values + i));
+				}
+
+				const Register combined = CombineRegisters<_Operation, Simd>(
+					CombineRegisters<_Operation, Simd>(accumulators[0], accumulators[1]),
+					CombineRegisters<_Operation, Simd>(accumulators[2], accumulators[3])
+				);
+
+				// Combine the lanes of the register into their results
+				_Type lanes[Simd::width];
+				Simd::Store(lanes, combined);
+
+				for (size stride = 0; stride < _Stride; ++stride)
+				{
+					_result[stride] = lanes[stride];
+				}
+
+				for (size lane = _Stride; lane < Simd::width; ++lane)
+				{
+					_result[lane % _Stride] = Combine<_Operation>(_result[lane % _Stride], lanes[lane]);
+				}
+			}
+		}
+
+		// If the registers weren't used, start from the first values
+		if (i == 0)
+		{
+			for (size stride = 0; stride < _Stride; ++stride)
+			{
+				_result[stride] = _Operation == Operation::SUM ? _Type(0) : _values[stride];
+			}
+
+			i = _Operation == Operation::SUM ? 0 : _Stride;
+		}
+
+		for (; i < _count; ++i)
+		{
+			_result[i % _Stride] = Combine<_Operation>(_result[i % _Stride], _values[i]);
+		}
+	}
+
+	/**
+	* Reduces _count values into both their minimum and maximum in a single pass
+	* The requirements are the same as Reduce(...), and _count must not be 0
+	*/
+	template<size _Stride, typename _Type>
+	static void ReduceBounds(_Type (&_minimum)[_Stride], _Type (&_maximum)[_Stride], const _Type* _values, const size _count)
+	{
+		size i = 0;
+
+		if constexpr (SimdBatch<_Type>::isEnabled)
+		{
+			using Simd = SimdBatch<_Type>;
+			using Register = typename Simd::Register;
+
+			static_assert(Simd::width % _Stride == 0, "Stride must divide the width of the register");
+
+			if (_count >= Simd::width)
+			{
+				Register minimum[2] = { Simd::Load(_values), Simd::Load(_values) };
+				Register maximum[2] = { minimum[0], minimum[0] };
+
+				for (; i + 2 * Simd::width <= _count; i += 2 * Simd::width)
+				{
+					const Register values0 = Simd::Load(_values + i);
+					const Register values1 = Simd::Load(_values + i + Simd::width);
+
+					minimum[0] = Simd::Minimum(minimum[0], values0);
+					minimum[1] = Simd::Minimum(minimum[1], values1);
+					maximum[0] = Simd::Maximum(maximum[0], values0);
+					maximum[1] = Simd::Maximum(maximum[1], values1);
+				}
+
+				for (; i + Simd::width <= _count; i += Simd::width)
+				{
+					const Register values = Simd::Load(_values + i);
+
+					minimum[0] = Simd::Minimum(minimum[0], values);
+					maximum[0] = Simd::Maximum(maximum[0], values);
+				}
+
+				_Type minimumLanes[Simd::width];
+				_Type maximumLanes[Simd::width];
+				Simd::Store(minimumLanes, Simd::Minimum(minimum[0], minimum[1]));
+				Simd::Store(maximumLanes, Simd::Maximum(maximum[0], maximum[1]));
+
+				for (size stride = 0; stride < _Stride; ++stride)
+				{
+					_minimum[stride] = minimumLanes[stride];
+					_maximum[stride] = maximumLanes[stride];
+				}
+
+				for (size lane = _Stride; lane < Simd::width; ++lane)
+				{
+					_minimum[lane % _Stride] = Combine<Operation::MINIMUM>(_minimum[lane % _Stride], minimumLanes[lane]);
+					_maximum[lane % _Stride] = Combine<Operation::MAXIMUM>(_maximum[lane % _Stride], maximumLanes[lane]);
+				}
+			}
+		}
+
+		if (i == 0)
+		{
+			for (size stride = 0; stride < _Stride; ++stride)
+			{
+				_minimum[stride] = _values[stride];
+				_maximum[stride] = _values[stride];
+			}
+
+			i = _Stride;
+		}
+
+		for (; i < _count; ++i)
+		{
+			_minimum[i % _Stride] = Combine<Operation::MINIMUM>(_minimum[i % _Stride], _values[i]);
+			_maximum[i % _Stride] = Combine<Operation::MAXIMUM>(_maximum[i % _Stride], _values[i]);
+		}
+	}
+
+	/**
+	* Returns the index of the first value equal to _target, or _count if there isn't one
+	*/
+	template<typename _Type>
+	static size FindFirst(const _Type* _values, const size _count, const _Type _target)
+	{
+		size i = 0;
+
+		if constexpr (SimdBatch<_Type>::isEnabled)
+		{
+			using Simd = SimdBatch<_Type>;
+
+			const typename Simd::Register target = Simd::Broadcast(_target);
+
+			for (; i + Simd::width <= _count; i += Simd::width)
+			{
+				const u32 mask = Simd::GetMask(Simd::IsEqual(Simd::Load(_values + i), target));
+
+				if (mask != 0)
+				{
+					return i + static_cast<size>(std::countr_zero(mask));
+				}
+			}
+		}
+
+		for (; i < _count; ++i)
+		{
+			if (_values[i] == _target)
+			{
+				return i;
+			}
+		}
+
+		return _count;
+	}
+
+	/**
+	* Returns the index of the first NaN, or _count if there isn't one
+	*/
+	template<typename _Type>
+	static size FindFirstNaN(const _Type* _values, const size _count)
+	{
+		size i = 0;
+
+		if constexpr (SimdBatch<_Type>::isEnabled)
+		{
+			using Simd = SimdBatch<_Type>;
+
+			constexpr u32 allLanes = (u32(1) << Simd::width) - 1;
+
+			for (; i + Simd::width <= _count; i += Simd::width)
+			{
+				const typename Simd::Register values = Simd::Load(_values + i);
+
+				// Only NaN lanes compare unequal to themselves
+				const u32 mask = Simd::GetMask(Simd::IsEqual(values, values));
+
+				if (mask != allLanes)
+				{
+					return i + static_cast<size>(std::countr_one(mask));
+				}
+			}
+		}
+
+		for (; i < _count; ++i)
+		{
+			if (_values[i] != _values[i])
+			{
+				return i;
+			}
+		}
+
+		return _count;
+	}
+
+	/**
+	* Describes how the values of an array are reduced
+	* Arithmetic values are reduced directly, and Vector2 values are reduced per component
+	*/
+	template<typename _Type>
+	struct Element
+	{
+		static_assert(std::is_arithmetic<_Type>::value, "Type of reduction must be numeric or a Vector2");
+
+		using Component = _Type;
+
+		// The number of components per value
+		static constexpr size stride = 1;
+
+		static inline const Component* GetComponents(const _Type* _values) { return _values; }
+
+		static inline _Type FromComponents(const Component (&_components)[stride]) { return _components[0]; }
+	};
+
+	template<typename _Type>
+	struct Element<Vector2<_Type>>
+	{
+		static_assert(sizeof(Vector2<_Type>) == 2 * sizeof(_Type), "Vector2 must not contain any padding");
+
+		using Component = _Type;
+
+		// The number of components per value
+		static constexpr size stride = 2;
+
+		static inline const Component* GetComponents(const Vector2<_Type>* _values)
+		{
+			return reinterpret_cast<const Component*>(_values);
+		}
+
+		static inline Vector2<_Type> FromComponents(const Component (&_components)[stride])
+		{
+			return Vector2<_Type>(_components[0], _components[1]);
+		}
+	};
+
+	/**
+	* Reduces an array of arithmetic or Vector2 values with _Operation
+	*/
+	template<Operation _Operation, typename _Type>
+	static inline _Type ReduceElements(const std::span<const _Type> _values)
+	{
+		using ElementType = Element<_Type>;
+
+		typename ElementType::Component result[ElementType::stride];
+		Reduce<_Operation>(result, ElementType::GetComponents(_values.data()), ElementType::stride * _values.size());
+
+		return ElementType::FromComponents(result);
+	}
+};
+
+/**
+* Returns the sum of all values
+* Vector2 values are summed per component
+* With SIMD, the values are summed in a different order to a sequential loop, so floating point results may differ from one
+* in rounding
+* The sum of an empty array is 0
+*/
+template<typename _Type>
+Status Sum(SLR_RETURN(std::remove_const_t<_Type>) _result, const std::span<_Type> _values)
+{
+	_result = ReductionImplementation::ReduceElements<ReductionImplementation::Operation::SUM, std::remove_const_t<_Type>>(_values);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns the smallest value
+* For Vector2 values, this is the minimum of each component, which is the lower corner of their bounding box
+* Fails if the array is empty
+*/
+template<typename _Type>
+Status Min(SLR_RETURN(std::remove_const_t<_Type>) _result, const std::span<_Type> _values)
+{
+	SLR_ASSERT_ERROR(!_values.empty(), "Cannot find the minimum of an empty array")
+	{
+		return Status::FAIL;
+	}
+
+	_result = ReductionImplementation::ReduceElements<ReductionImplementation::Operation::MINIMUM, std::remove_const_t<_Type>>(_values);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns the largest value
+* For Vector2 values, this is the maximum of each component, which is the upper corner of their bounding box
+* Fails if the array is empty
+*/
+template<typename _Type>
+Status Max(SLR_RETURN(std::remove_const_t<_Type>) _result, const std::span<_Type> _values)
+{
+	SLR_ASSERT_ERROR(!_values.empty(), "Cannot find the maximum of an empty array")
+	{
+		return Status::FAIL;
+	}
+
+	_result = ReductionImplementation::ReduceElements<ReductionImplementation::Operation::MAXIMUM, std::remove_const_t<_Type>>(_values);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns both the smallest and largest value, in a single pass over the array
+* For Vector2 values, these are the lower and upper corners of their bounding box
+* Fails if the array is empty
+*/
+template<typename _Type>
+Status MinMax(
+	SLR_RETURN(std::remove_const_t<_Type>) _minimum,
+	SLR_RETURN(std::remove_const_t<_Type>) _maximum,
+	const std::span<_Type> _values
+)
+{
+	using Element = ReductionImplementation::Element<std::remove_const_t<_Type>>;
+
+	SLR_ASSERT_ERROR(!_values.empty(), "Cannot find the bounds of an empty array")
+	{
+		return Status::FAIL;
+	}
+
+	typename Element::Component minimum[Element::stride];
+	typename Element::Component maximum[Element::stride];
+	ReductionImplementation::ReduceBounds(minimum, maximum, Element::GetComponents(_values.data()), Element::stride * _values.size());
+
+	_minimum = Element::FromComponents(minimum);
+	_maximum = Element::FromComponents(maximum);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns the index of the first occurrence of the smallest value
+* If any value is NaN, the index of the first NaN is returned instead, as NaN has no order
+* Fails if the array is empty
+*/
+template<typename _Type>
+Status ArgMin(SLR_RETURN(size) _index, const std::span<_Type> _values)
+{
+	static_assert(std::is_arithmetic<std::remove_const_t<_Type>>::value, "Type of ArgMin must be numeric");
+
+	if constexpr (std::is_floating_point<std::remove_const_t<_Type>>::value)
+	{
+		_index = ReductionImplementation::FindFirstNaN(_values.data(), _values.size());
+
+		if (_index != _values.size())
+		{
+			return Status::SUCCESS;
+		}
+	}
+
+	std::remove_const_t<_Type> minimum = {};
+	Status minStatus = Min(minimum, _values);
+
+	SLR_ASSERT_ERROR(minStatus == Status::SUCCESS, "Could not find the minimum value")
+	{
+		return Status::FAIL;
+	}
+
+	_index = ReductionImplementation::FindFirst(_values.data(), _values.size(), minimum);
+
+	SLR_ASSERT_ERROR(_index != _values.size(), "The minimum value was not found in the array")
+	{
+		return Status::FAIL;
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns the index of the first occurrence of the largest value
+* If any value is NaN, the index of the first NaN is returned instead, as NaN has no order
+* Fails if the array is empty
+*/
+template<typename _Type>
+Status ArgMax(SLR_RETURN(size) _index, const std::span<_Type> _values)
+{
+	static_assert(std::is_arithmetic<std::remove_const_t<_Type>>::value, "Type of ArgMax must be numeric");
+
+	if constexpr (std::is_floating_point<std::remove_const_t<_Type>>::value)
+	{
+		_index = ReductionImplementation::FindFirstNaN(_values.data(), _values.size());
+
+		if (_index != _values.size())
+		{
+			return Status::SUCCESS;
+		}
+	}
+
+	std::remove_const_t<_Type> maximum = {};
+	Status maxStatus = Max(maximum, _values);
+
+	SLR_ASSERT_ERROR(maxStatus == Status::SUCCESS, "Could not find the maximum value")
+	{
+		return Status::FAIL;
+	}
+
+	_index = ReductionImplementation::FindFirst(_values.data(), _values.size(), maximum);
+
+	SLR_ASSERT_ERROR(_index != _values.size(), "The maximum value was not found in the array")
+	{
+		return Status::FAIL;
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns the sum of all values of a DynamicArray
+*/
+template<typename _Type>
+Status Sum(SLR_RETURN(_Type) _result, const DynamicArray<_Type>& _values)
+{
+	std::span<const _Type> values;
+	_values.GetSpan(values);
+
+	return Sum(_result, values);
+}
+
+/**
+* Returns the smallest value of a DynamicArray
+* Fails if the array is empty
+*/
+template<typename _Type>
+Status Min(SLR_RETURN(_Type) _result, const DynamicArray<_Type>& _values)
+{
+	std::span<const _Type> values;
+	_values.GetSpan(values);
+
+	return Min(_result, values);
+}
+
+/**
+* Returns the largest value of a DynamicArray
+* Fails if the array is empty
+*/
+template<typename _Type>
+Status Max(SLR_RETURN(_Type) _result, const DynamicArray<_Type>& _values)
+{
+	std::span<const _Type> values;
+	_values.GetSpan(values);
+
+	return Max(_result, values);
+}
+
+/**
+* Returns both the smallest and largest value of a DynamicArray
+* Fails if the array is empty
+*/
+template<typename _Type>
+Status MinMax(SLR_RETURN(_Type) _minimum, SLR_RETURN(_Type) _maximum, const DynamicArray<_Type>& _values)
+{
+	std::span<const _Type> values;
+	_values.GetSpan(values);
+
+	return MinMax(_minimum, _maximum, values);
+}
+
+/**
+* Returns the index of the first occurrence of the smallest value of a DynamicArray
+* If any value is NaN, the index of the first NaN is returned instead
+* Fails if the array is empty
+*/
+template<typename _Type>
+Status ArgMin(SLR_RETURN(size) _index, const DynamicArray<_Type>& _values)
+{
+	std::span<const _Type> values;
+	_values.GetSpan(values);
+
+	return ArgMin(_index, values);
+}
+
+/**
+* Returns the index of the first occurrence of the largest value of a DynamicArray
+* If any value is NaN, the index of the first NaN is returned instead
+* Fails if the array is empty
+*/
+template<typename _Type>
+Status ArgMax(SLR_RETURN(size) _index, const DynamicArray<_Type>& _values)
+{
+	std::span<const _Type> values;
+	_values.GetSpan(values);
+
+	return ArgMax(_index, values);
+}
+
+/**
+* Returns _value with each component limited to the range given by the components of _minimum and _maximum
+* Fails if any component of _minimum is greater than that of _maximum
+*/
+template<typename _Type>
+constexpr Status Clamp(
+	SLR_RETURN(Vector2<_Type>) _result,
+	const Vector2<_Type>& _value,
+	const Vector2<_Type>& _minimum,
+	const Vector2<_Type>& _maximum
+)
+{
+	_Type x;
+	_Type y;
+
+	Status xStatus = Clamp(x, _value.x, _minimum.x, _maximum.x);
+	Status yStatus = Clamp(y, _value.y, _minimum.y, _maximum.y);
+
+	SLR_ASSERT_ERROR(xStatus == Status::SUCCESS && yStatus == Status::SUCCESS, "Could not clamp the components of the vector")
+	{
+		return Status::FAIL;
+	}
+
+	_result = Vector2<_Type>(x, y);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Limits each value of _values to the range [_minimum, _maximum]
+* Fails if _minimum is greater than _maximum
+* _result may be the same array as _values
+*/
+template<typename _Type>
+Status BatchClamp(
+	const std::span<_Type> _result,
+	const std::span<const std::type_identity_t<_Type>> _values,
+	const std::type_identity_t<_Type> _minimum,
+	const std::type_identity_t<_Type> _maximum
+)
+{
+	SLR_ASSERT_ERROR(_values.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(!(_maximum < _minimum), "Minimum of clamp range is greater than the maximum")
+	{
+		return Status::FAIL;
+	}
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		const typename Simd::Register minimum = Simd::Broadcast(_minimum);
+		const typename Simd::Register maximum = Simd::Broadcast(_maximum);
+
+		for (; i + Simd::width <= _result.size(); i += Simd::width)
+		{
+			Simd::Store(_result.data() + i, Simd::Minimum(Simd::Maximum(Simd::Load(_values.data() + i), minimum), maximum));
+		}
+	}
+
+	for (; i < _result.size(); ++i)
+	{
+		Clamp(_result[i], _values[i], _minimum, _maximum);
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Limits each component of each vector of _values to the range given by the components of _minimum and _maximum
+* Fails if any component of _minimum is greater than that of _maximum
+* _result may be the same array as _values
+*/
+template<typename _Type>
+Status BatchClamp(
+	const std::span<Vector2<_Type>> _result,
+	const std::span<const Vector2<std::type_identity_t<_Type>>> _values,
+	const Vector2<std::type_identity_t<_Type>>& _minimum,
+	const Vector2<std::type_identity_t<_Type>>& _maximum
+)
+{
+	SLR_ASSERT_ERROR(_values.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(!(_maximum.x < _minimum.x) && !(_maximum.y < _minimum.y), "Minimum of clamp range is greater than the maximum")
+	{
+		return Status::FAIL;
+	}
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		_Type* result = reinterpret_cast<_Type*>(_result.data());
+		const _Type* values = reinterpret_cast<const _Type*>(_values.data());
+
+		const typename Simd::Register minimum = Simd::BroadcastPair(_minimum.x, _minimum.y);
+		const typename Simd::Register maximum = Simd::BroadcastPair(_maximum.x, _maximum.y);
+
+		// Each iteration processes one register of interleaved components, which is half a register of vectors
+		for (; 2 * i + Simd::width <= 2 * _result.size(); i += Simd::width / 2)
+		{
+			Simd::Store(result + 2 * i, Simd::Minimum(Simd::Maximum(Simd::Load(values + 2 * i), minimum), maximum));
+		}
+	}
+
+	for (; i < _result.size(); ++i)
+	{
+		Clamp(_result[i], _values[i], _minimum, _maximum);
+	}
+
+	return Status::SUCCESS;
+}
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MATH_REDUCTIONS
\ No newline at end of file
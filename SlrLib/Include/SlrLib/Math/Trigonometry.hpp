@@ -0,0 +1,376 @@
+#pragma once
+#ifndef SLR_MATH_TRIGONOMETRY
+#define SLR_MATH_TRIGONOMETRY
+
+#include <array>
+#include <cmath>
+#include <span>
+#include <type_traits>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/SimdBatch.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* The constants of the trigonometric approximations for _Type
+* The polynomials are the minimax approximations from the Cephes library, with coefficients ordered from the highest power
+*/
+template<typename _Type>
+struct TrigonometryConstants;
+
+template<>
+struct TrigonometryConstants<float>
+{
+	static constexpr float twoOverPi = 0.636619772367581343f;
+
+	/**
+	* pi / 2 split into parts with few enough bits that multiplying them by the quadrant is exact
+	*/
+	static constexpr std::array<float, 3> halfPi = { 1.5703125f, 4.837512969970703125e-4f, 7.54978995489188216e-8f };
+
+	static constexpr std::array<float, 3> sine = { -1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f };
+
+	static constexpr std::array<float, 3> cosine = { 2.443315711809948e-5f, -1.388731625493765e-3f, 4.166664568298827e-2f };
+
+	/**
+	* Above tan(pi / 8), arctangents are calculated from the reduced argument (a - 1) / (a + 1)
+	*/
+	static constexpr float atanReduction = 0.414213562373095049f;
+
+	static constexpr float atanReductionOffset = 0.785398163397448310f;
+
+	static constexpr std::array<float, 4> atanNumerator = { 8.05374449538e-2f, -1.38776856032e-1f, 1.99777106478e-1f, -3.33329491539e-1f };
+
+	static constexpr std::array<float, 1> atanDenominator = { 1.0f };
+};
+
+template<>
+struct TrigonometryConstants<double>
+{
+	static constexpr double twoOverPi = 0.636619772367581343;
+
+	/**
+	* pi / 2 split into parts with few enough bits that multiplying them by the quadrant is exact
+	*/
+	static constexpr std::array<double, 3> halfPi = { 1.57079632673412561417e+0, 6.07710050630396597660e-11, 2.02226624879595063154e-21 };
+
+	static constexpr std::array<double, 6> sine = {
+		1.58962301576546568060e-10, -2.50507477628578072866e-8, 2.75573136213857245213e-6,
+		-1.98412698295895385996e-4, 8.33333333332211858878e-3, -1.66666666666666307295e-1
+	};
+
+	static constexpr std::array<double, 6> cosine = {
+		-1.13585365213876817300e-11, 2.08757008419747316778e-9, -2.75573141792967388112e-7,
+		2.48015872888517045348e-5, -1.38888888888730564116e-3, 4.16666666666665929218e-2
+	};
+
+	/**
+	* Above 0.66, arctangents are calculated from the reduced argument (a - 1) / (a + 1)
+	* The offset is pi / 4 plus half of the part of pi / 2 which a double cannot hold
+	*/
+	static constexpr double atanReduction = 0.66;
+
+	static constexpr double atanReductionOffset = 0.785398163397448310 + 3.061616997868382943e-17;
+
+	static constexpr std::array<double, 5> atanNumerator = {
+		-8.750608600031904122785e-1, -1.615753718733365076637e+1, -7.500855792314704667340e+1,
+		-1.228866684490136173410e+2, -6.485021904942025371773e+1
+	};
+
+	static constexpr std::array<double, 6> atanDenominator = {
+		1.0, 2.485846490142306297962e+1, 1.650270098316988542046e+2,
+		4.328810604912902668951e+2, 4.853903996359136964868e+2, 1.945506571482613964425e+2
+	};
+};
+
+/**
+* Shared implementation of the trigonometric approximations
+* This class is purely to hide the implementation from the user to make it clear not to interact with anything contained
+* within it
+* The kernels are written once against the interface of SimdBatch, and Scalar<_Type> provides the same interface for single
+* values, so the scalar and batch functions give the same results (apart from fused multiply-adds in the batch functions).
+*/
+class TrigonometryImplementation
+{
+public:
+	/**
+	* SimdBatch operations on a single value, where masks are bools
+	*/
+	template<typename _Type>
+	struct Scalar
+	{
+		using Register = _Type;
+
+		static inline _Type Broadcast(const _Type _value) { return _value; }
+
+		static inline _Type Add(const _Type _left, const _Type _right) { return _left + _right; }
+
+		static inline _Type Subtract(const _Type _left, const _Type _right) { return _left - _right; }
+
+		static inline _Type Multiply(const _Type _left, const _Type _right) { return _left * _right; }
+
+		static inline _Type Divide(const _Type _left, const _Type _right) { return _left / _right; }
+
+		static inline _Type MultiplyAdd(const _Type _left, const _Type _right, const _Type _add) { return (_left * _right) + _add; }
+
+		static inline _Type Minimum(const _Type _left, const _Type _right) { return _left < _right ? _left : _right; }
+
+		static inline _Type Maximum(const _Type _left, const _Type _right) { return _left > _right ? _left : _right; }
+
+		static inline _Type Abs(const _Type _value) { return std::fabs(_value); }
+
+		static inline _Type Floor(const _Type _value) { return std::floor(_value); }
+
+		static inline _Type Round(const _Type _value) { return std::nearbyint(_value); }
+
+		static inline bool IsZero(const _Type _value) { return _value == 0; }
+
+		static inline bool IsEqual(const _Type _left, const _Type _right) { return _left == _right; }
+
+		static inline bool IsLess(const _Type _left, const _Type _right) { return _left < _right; }
+
+		static inline bool IsLessOrEqual(const _Type _left, const _Type _right) { return _left <= _right; }
+
+		static inline bool Or(const bool _left, const bool _right) { return _left || _right; }
+
+		static inline _Type Select(const bool _mask, const _Type _ifTrue, const _Type _ifFalse) { return _mask ? _ifTrue : _ifFalse; }
+
+		static inline _Type NegateWhere(const bool _mask, const _Type _value) { return _mask ? -_value : _value; }
+	};
+
+	/**
+	* Evaluates a polynomial of _value with Horner's method
+	*/
+	template<typename _Ops, typename _Type, size _Count>
+	static inline typename _Ops::Register Polynomial(const typename _Ops::Register _value, const std::array<_Type, _Count>& _coefficients)
+	{
+		typename _Ops::Register result = _Ops::Broadcast(_coefficients[0]);
+
+		for (size i = 1; i < _Count; ++i)
+		{
+			result = _Ops::MultiplyAdd(result, _value, _Ops::Broadcast(_coefficients[i]));
+		}
+
+		return result;
+	}
+
+	/**
+	* Calculates the sine and cosine of _angle
+	* The angle is reduced to within [-pi / 4, pi / 4] by subtracting the nearest multiple of pi / 2, then both polynomials
+	* are evaluated and swapped or negated according to the quadrant
+	*/
+	template<typename _Ops, typename _Type>
+	static inline void SinCos(typename _Ops::Register& _sin, typename _Ops::Register& _cos, const typename _Ops::Register _angle)
+	{
+		using Constants = TrigonometryConstants<_Type>;
+		using Register = typename _Ops::Register;
+
+		const Register quadrant = _Ops::Round(_Ops::Multiply(_angle, _Ops::Broadcast(Constants::twoOverPi)));
+
+		Register reduced = _angle;
+		reduced = _Ops::MultiplyAdd(quadrant, _Ops::Broadcast(-Constants::halfPi[0]), reduced);
+		reduced = _Ops::MultiplyAdd(quadrant, _Ops::Broadcast(-Constants::halfPi[1]), reduced);
+		reduced = _Ops::MultiplyAdd(quadrant, _Ops::Broadcast(-Constants::halfPi[2]), reduced);
+
+		const Register squared = _Ops::Multiply(reduced, reduced);
+
+		const Register sine = _Ops::MultiplyAdd(
+			_Ops::Multiply(reduced, squared),
+			Polynomial<_Ops>(squared, Constants::sine),
+			reduced
+		);
+
+		const Register cosine = _Ops::MultiplyAdd(
+			_Ops::Multiply(squared, squared),
+			Polynomial<_Ops>(squared, Constants::cosine),
+			_Ops::MultiplyAdd(squared, _Ops::Broadcast(_Type(-0.5)), _Ops::Broadcast(_Type(1)))
+		);
+
+		// The quadrant modulo 4, calculated without converting to integers
+		const Register remainder = _Ops::Subtract(
+			quadrant,
+			_Ops::Multiply(_Ops::Floor(_Ops::Multiply(quadrant, _Ops::Broadcast(_Type(0.25)))), _Ops::Broadcast(_Type(4)))
+		);
+
+		const auto isOne = _Ops::IsEqual(remainder, _Ops::Broadcast(_Type(1)));
+		const auto isTwo = _Ops::IsEqual(remainder, _Ops::Broadcast(_Type(2)));
+		const auto isThree = _Ops::IsEqual(remainder, _Ops::Broadcast(_Type(3)));
+
+		const auto isSwapped = _Ops::Or(isOne, isThree);
+
+		_sin = _Ops::NegateWhere(_Ops::Or(isTwo, isThree), _Ops::Select(isSwapped, cosine, sine));
+		_cos = _Ops::NegateWhere(_Ops::Or(isOne, isTwo), _Ops::Select(isSwapped, sine, cosine));
+	}
+
+	/**
+	* Calculates the angle of (_x, _y) from the positive x axis
+	* The ratio of the smaller to the larger magnitude is within [0, 1], so its arctangent is within [0, pi / 4]; the octant
+	* is then restored from the magnitudes and signs of the components
+	*/
+	template<typename _Ops, typename _Type>
+	static inline typename _Ops::Register Atan2(const typename _Ops::Register _y, const typename _Ops::Register _x)
+	{
+		using Constants = TrigonometryConstants<_Type>;
+		using Register = typename _Ops::Register;
+
+		const Register zero = _Ops::Broadcast(_Type(0));
+		const Register one = _Ops::Broadcast(_Type(1));
+
+		const Register absoluteX = _Ops::Abs(_x);
+		const Register absoluteY = _Ops::Abs(_y);
+
+		const Register larger = _Ops::Maximum(absoluteX, absoluteY);
+		const Register smaller = _Ops::Minimum(absoluteX, absoluteY);
+
+		// Avoid 0 / 0 at the origin, where the angle is 0
+		Register ratio = _Ops::Select(_Ops::IsZero(larger), zero, _Ops::Divide(smaller, _Ops::Select(_Ops::IsZero(larger), one, larger)));
+
+		const auto isReduced = _Ops::IsLess(_Ops::Broadcast(Constants::atanReduction), ratio);
+
+		ratio = _Ops::Select(isReduced, _Ops::Divide(_Ops::Subtract(ratio, one), _Ops::Add(ratio, one)), ratio);
+
+		const Register squared = _Ops::Multiply(ratio, ratio);
+
+		Register polynomial = _Ops::Multiply(squared, Polynomial<_Ops>(squared, Constants::atanNumerator));
+
+		if constexpr (Constants::atanDenominator.size() > 1)
+		{
+			polynomial = _Ops::Divide(polynomial, Polynomial<_Ops>(squared, Constants::atanDenominator));
+		}
+
+		Register angle = _Ops::Add(
+			_Ops::Select(isReduced, _Ops::Broadcast(Constants::atanReductionOffset), zero),
+			_Ops::MultiplyAdd(ratio, polynomial, ratio)
+		);
+
+		constexpr _Type halfPi = _Type(1.57079632679489661923);
+		constexpr _Type pi = _Type(3.14159265358979323846);
+
+		angle = _Ops::Select(_Ops::IsLess(absoluteX, absoluteY), _Ops::Subtract(_Ops::Broadcast(halfPi), angle), angle);
+		angle = _Ops::Select(_Ops::IsLess(_x, zero), _Ops::Subtract(_Ops::Broadcast(pi), angle), angle);
+
+		return _Ops::NegateWhere(_Ops::IsLess(_y, zero), angle);
+	}
+};
+
+/**
+* Returns approximations of the sine and cosine of _angle, in radians
+* For floats, the absolute error is below 1e-7 while |_angle| <= 8192. For doubles, the absolute error is below 2.1e-16
+* while |_angle| <= 1e6. Beyond these, the error of the range reduction grows with the angle. Infinities and NaN give NaN.
+*/
+template<typename _Type>
+inline Status SinCos(SLR_RETURN(_Type) _sin, SLR_RETURN(_Type) _cos, const _Type _angle)
+{
+	static_assert(std::is_floating_point<_Type>::value, "Type of sine and cosine must be floating point");
+
+	TrigonometryImplementation::SinCos<TrigonometryImplementation::Scalar<_Type>, _Type>(_sin, _cos, _angle);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns an approximation of the angle of (_x, _y) from the positive x axis, in radians within [-pi, pi]
+* For floats, the absolute error is below 2.8e-7, and for doubles below 4.6e-16. The angle of (0, 0) is 0, and signed
+* zeros are treated as positive, so unlike std::atan2, Atan2(-0, -1) gives pi rather than -pi. Infinite components are not
+* supported.
+*/
+template<typename _Type>
+inline Status Atan2(SLR_RETURN(_Type) _result, const _Type _y, const _Type _x)
+{
+	static_assert(std::is_floating_point<_Type>::value, "Type of arctangent must be floating point");
+
+	_result = TrigonometryImplementation::Atan2<TrigonometryImplementation::Scalar<_Type>, _Type>(_y, _x);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Calculates SinCos(...) of each angle of _angles
+* When FMA is available, the results may differ from SinCos(...) in the last bit
+* _sin or _cos may be the same array as _angles
+*/
+template<typename _Type>
+Status BatchSinCos(
+	const std::span<_Type> _sin,
+	const std::span<_Type> _cos,
+	const std::span<const std::type_identity_t<_Type>> _angles
+)
+{
+	static_assert(std::is_floating_point<_Type>::value, "Type of sine and cosine must be floating point");
+
+	SLR_ASSERT_ERROR(_sin.size() == _angles.size() && _cos.size() == _angles.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		for (; i + Simd::width <= _angles.size(); i += Simd::width)
+		{
+			typename Simd::Register sine;
+			typename Simd::Register cosine;
+
+			TrigonometryImplementation::SinCos<Simd, _Type>(sine, cosine, Simd::Load(_angles.data() + i));
+
+			Simd::Store(_sin.data() + i, sine);
+			Simd::Store(_cos.data() + i, cosine);
+		}
+	}
+
+	for (; i < _angles.size(); ++i)
+	{
+		SinCos(_sin[i], _cos[i], _angles[i]);
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Calculates Atan2(...) of each value of _y with the value of _x at the same index
+* When FMA is available, the results may differ from Atan2(...) in the last bit
+* _result may be the same array as _y or _x
+*/
+template<typename _Type>
+Status BatchAtan2(
+	const std::span<_Type> _result,
+	const std::span<const std::type_identity_t<_Type>> _y,
+	const std::span<const std::type_identity_t<_Type>> _x
+)
+{
+	static_assert(std::is_floating_point<_Type>::value, "Type of arctangent must be floating point");
+
+	SLR_ASSERT_ERROR(_y.size() == _result.size() && _x.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		for (; i + Simd::width <= _result.size(); i += Simd::width)
+		{
+			Simd::Store(_result.data() + i, TrigonometryImplementation::Atan2<Simd, _Type>(Simd::Load(_y.data() + i), Simd::Load(_x.data() + i)));
+		}
+	}
+
+	for (; i < _result.size(); ++i)
+	{
+		Atan2(_result[i], _y[i], _x[i]);
+	}
+
+	return Status::SUCCESS;
+}
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MATH_TRIGONOMETRY
\ No newline at end of file
@@ -16,7 +16,7 @@ SLR_NAMESPACE_BEGIN
 template<typename _Type>
 struct Vector2
 {
-	static_assert(std::is_arithmetic<_Type>::value, "Type of vector template must be numeric");
+	static_assert(IsNumeric<_Type>::value, "Type of vector template must be numeric");
 
 	/**
 	* The x component of the vector
@@ -220,11 +220,9 @@ struct Vector2
 	*/
 	constexpr Status Magnitude(SLR_RETURN(_Type) _result) const
 	{
-		// Calculate the magnitude squared
-		const _Type magnitudeSquared = (this->x * this->x) + (this->y * this->y);
-
-		// Assign the return value for the square root of the magnitude
-		Status sqrtStatus = Sqrt(_result, magnitudeSquared);
+		// Assign the return value for the square root of the magnitude squared
+		// Hypot(...) is the same calculation for the arithmetic types, but lets numeric classes avoid overflowing the square
+		Status sqrtStatus = Hypot(_result, this->x, this->y);
 
 		SLR_ASSERT_ERROR(sqrtStatus == Status::SUCCESS, "Could not calculate square root of magnitude squared")
 		{
@@ -266,8 +264,47 @@ struct Vector2
 			return Status::FAIL;
 		}
 
-		// Get the inverse magnitude of the vector
-		const _Type inverseMagnitude = _Type(1) / magnitude;
+		if constexpr (std::is_floating_point<_Type>::value)
+		{
+			// Get the inverse magnitude of the vector
+			const _Type inverseMagnitude = _Type(1) / magnitude;
+
+			// Normalize the vector and return it
+			_result = Vector2(this->x * inverseMagnitude, this->y * inverseMagnitude);
+		}
+		else
+		{
+			// The inverse magnitude of a fixed point vector would lose most of its precision, so divide each component
+			_result = Vector2(this->x / magnitude, this->y / magnitude);
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the normalized version of the vector, using an approximate reciprocal square root
+	* Refer to SqrtPrecision for the error bounds
+	*/
+	template<SqrtPrecision _Precision = SqrtPrecision::MEDIUM>
+	constexpr Status NormalizedFast(SLR_RETURN(Vector2) _result) const
+	{
+		// Get the magnitude squared of the vector
+		_Type magnitudeSquared;
+		this->MagnitudeSquared(magnitudeSquared);
+
+		SLR_ASSERT_ERROR(magnitudeSquared != 0, "Magnitude resulted to zero and therefore cannot be normalized")
+		{
+			return Status::FAIL;
+		}
+
+		// Get the approximate inverse magnitude of the vector
+		_Type inverseMagnitude;
+		Status rsqrtStatus = RSqrt<_Precision>(inverseMagnitude, magnitudeSquared);
+
+		SLR_ASSERT_ERROR(rsqrtStatus == Status::SUCCESS, "Could not calculate the inverse magnitude to normalize vector")
+		{
+			return Status::FAIL;
+		}
 
 		// Normalize the vector and return it
 		_result = Vector2(this->x * inverseMagnitude, this->y * inverseMagnitude);
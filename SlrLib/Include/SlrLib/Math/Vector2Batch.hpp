@@ -0,0 +1,825 @@
+#pragma once
+#ifndef SLR_MATH_VECTOR2BATCH
+#define SLR_MATH_VECTOR2BATCH
+
+#include <span>
+#include <type_traits>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/SimdBatch.hpp"
+#include "SlrLib/Math/Functions.hpp"
+#include "SlrLib/Math/Trigonometry.hpp"
+#include "SlrLib/Math/Vector2.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* A view of an array of vectors stored as structure of arrays
+* The x and y components of each vector are held in separate arrays, which are expected to be the same size. The view does
+* not own the arrays.
+* A Vector2SoA<const _Type> can be created from a Vector2SoA<_Type> for read-only access.
+*/
+template<typename _Type>
+struct Vector2SoA
+{
+	static_assert(IsNumeric<std::remove_const_t<_Type>>::value, "Type of vector template must be numeric");
+
+	/**
+	* The x components of the vectors
+	*/
+	std::span<_Type> x;
+
+	/**
+	* The y components of the vectors
+	*/
+	std::span<_Type> y;
+
+	/**
+	* Default constructor
+	* The view is empty
+	*/
+	constexpr Vector2SoA() = default;
+
+	/**
+	* Constructor
+	* Takes the arrays of the x and y components
+	*/
+	constexpr Vector2SoA(const std::span<_Type> _x, const std::span<_Type> _y) : x(_x), y(_y) {}
+
+	/**
+	* Converting constructor
+	* Allows a view of mutable components to be passed where a view of const components is expected
+	*/
+	template<typename _Other>
+	constexpr Vector2SoA(const Vector2SoA<_Other>& _other) : x(_other.x), y(_other.y) {}
+
+	/**
+	* Returns the number of vectors within the view
+	*/
+	constexpr size GetSize() const { return x.size(); }
+
+	/**
+	* Returns whether the x and y arrays are the same size
+	*/
+	constexpr bool IsValid() const { return x.size() == y.size(); }
+};
+
+/**
+* Shared implementation of the batch kernels
+* This class is purely to hide the implementation from the user to make it clear not to interact with anything contained
+* within it
+*/
+class Vector2BatchImplementation
+{
+public:
+	/**
+	* Returns the components of an array of vectors as a flat array of x, y, x, y, ...
+	*/
+	template<typename _Type>
+	static inline _Type* GetComponents(const std::span<Vector2<_Type>> _vectors)
+	{
+		static_assert(sizeof(Vector2<_Type>) == 2 * sizeof(_Type), "Vector2 must not contain any padding");
+
+		return reinterpret_cast<_Type*>(_vectors.data());
+	}
+
+	template<typename _Type>
+	static inline const _Type* GetComponents(const std::span<const Vector2<_Type>> _vectors)
+	{
+		static_assert(sizeof(Vector2<_Type>) == 2 * sizeof(_Type), "Vector2 must not contain any padding");
+
+		return reinterpret_cast<const _Type*>(_vectors.data());
+	}
+
+	/**
+	* Adds _count values of _left and _right together
+	*/
+	template<typename _Type>
+	static void Add(_Type* _result, const _Type* _left, const _Type* _right, const size _count)
+	{
+		size i = 0;
+
+		if constexpr (SimdBatch<_Type>::isEnabled)
+		{
+			using Simd = SimdBatch<_Type>;
+
+			for (; i + Simd::width <= _count; i += Simd::width)
+			{
+				Simd::Store(_result + i, Simd::Add(Simd::Load(_left + i), Simd::Load(_right + i)));
+			}
+		}
+
+		for (; i < _count; ++i)
+		{
+			_result[i] = _left[i] + _right[i];
+		}
+	}
+
+	/**
+	* Multiplies _count values of _values by _scale
+	*/
+	template<typename _Type>
+	static void Scale(_Type* _result, const _Type* _values, const _Type _scale, const size _count)
+	{
+		size i = 0;
+
+		if constexpr (SimdBatch<_Type>::isEnabled)
+		{
+			using Simd = SimdBatch<_Type>;
+
+			const typename Simd::Register scale = Simd::Broadcast(_scale);
+
+			for (; i + Simd::width <= _count; i += Simd::width)
+			{
+				Simd::Store(_result + i, Simd::Multiply(Simd::Load(_values + i), scale));
+			}
+		}
+
+		for (; i < _count; ++i)
+		{
+			_result[i] = _values[i] * _scale;
+		}
+	}
+};
+
+/**
+* Adds each vector of _left to the vector of _right at the same index
+* _result may be the same array as _left or _right
+*/
+template<typename _Type>
+Status BatchAdd(
+	std::span<Vector2<_Type>> _result,
+	const std::span<const Vector2<std::type_identity_t<_Type>>> _left,
+	const std::span<const Vector2<std::type_identity_t<_Type>>> _right
+)
+{
+	SLR_ASSERT_ERROR(_left.size() == _result.size() && _right.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	Vector2BatchImplementation::Add(
+		Vector2BatchImplementation::GetComponents(_result),
+		Vector2BatchImplementation::GetComponents(_left),
+		Vector2BatchImplementation::GetComponents(_right),
+		2 * _result.size()
+	);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Adds each vector of _left to the vector of _right at the same index
+* _result may be the same arrays as _left or _right
+*/
+template<typename _Type>
+Status BatchAdd(
+	const Vector2SoA<_Type>& _result,
+	const Vector2SoA<const std::type_identity_t<_Type>>& _left,
+	const Vector2SoA<const std::type_identity_t<_Type>>& _right
+)
+{
+	SLR_ASSERT_ERROR(_result.IsValid() && _left.IsValid() && _right.IsValid(), "Batch component arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(_left.GetSize() == _result.GetSize() && _right.GetSize() == _result.GetSize(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	Vector2BatchImplementation::Add(_result.x.data(), _left.x.data(), _right.x.data(), _result.GetSize());
+	Vector2BatchImplementation::Add(_result.y.data(), _left.y.data(), _right.y.data(), _result.GetSize());
+
+	return Status::SUCCESS;
+}
+
+/**
+* Multiplies each vector of _values by _scale
+* _result may be the same array as _values
+*/
+template<typename _Type>
+Status BatchScale(
+	std::span<Vector2<_Type>> _result,
+	const std::span<const Vector2<std::type_identity_t<_Type>>> _values,
+	const std::type_identity_t<_Type> _scale
+)
+{
+	SLR_ASSERT_ERROR(_values.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	Vector2BatchImplementation::Scale(
+		Vector2BatchImplementation::GetComponents(_result),
+		Vector2BatchImplementation::GetComponents(_values),
+		_scale,
+		2 * _result.size()
+	);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Multiplies each vector of _values by _scale
+* _result may be the same arrays as _values
+*/
+template<typename _Type>
+Status BatchScale(
+	const Vector2SoA<_Type>& _result,
+	const Vector2SoA<const std::type_identity_t<_Type>>& _values,
+	const std::type_identity_t<_Type> _scale
+)
+{
+	SLR_ASSERT_ERROR(_result.IsValid() && _values.IsValid(), "Batch component arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(_values.GetSize() == _result.GetSize(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	Vector2BatchImplementation::Scale(_result.x.data(), _values.x.data(), _scale, _result.GetSize());
+	Vector2BatchImplementation::Scale(_result.y.data(), _values.y.data(), _scale, _result.GetSize());
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns the dot product of each vector of _left with the vector of _right at the same index
+*/
+template<typename _Type>
+Status BatchDot(
+	std::span<_Type> _result,
+	const std::span<const Vector2<std::type_identity_t<_Type>>> _left,
+	const std::span<const Vector2<std::type_identity_t<_Type>>> _right
+)
+{
+	SLR_ASSERT_ERROR(_left.size() == _result.size() && _right.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	const _Type* left = Vector2BatchImplementation::GetComponents(_left);
+	const _Type* right = Vector2BatchImplementation::GetComponents(_right);
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		// Each iteration loads two registers of interleaved components, which is one register of vectors
+		for (; i + Simd::width <= _result.size(); i += Simd::width)
+		{
+			const typename Simd::Register products0 = Simd::Multiply(Simd::Load(left + 2 * i), Simd::Load(right + 2 * i));
+			const typename Simd::Register products1 = Simd::Multiply(Simd::Load(left + 2 * i + Simd::width), Simd::Load(right + 2 * i + Simd::width));
+
+			Simd::Store(_result.data() + i, Simd::AddPairs(products0, products1));
+		}
+	}
+
+	for (; i < _result.size(); ++i)
+	{
+		_result[i] = (_left[i].x * _right[i].x) + (_left[i].y * _right[i].y);
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns the dot product of each vector of _left with the vector of _right at the same index
+* When FMA is available, the results may differ from Vector2::Dot(...) in the last bit
+*/
+template<typename _Type>
+Status BatchDot(
+	const std::span<_Type> _result,
+	const Vector2SoA<const std::type_identity_t<_Type>>& _left,
+	const Vector2SoA<const std::type_identity_t<_Type>>& _right
+)
+{
+	SLR_ASSERT_ERROR(_left.IsValid() && _right.IsValid(), "Batch component arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(_left.GetSize() == _result.size() && _right.GetSize() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		for (; i + Simd::width <= _result.size(); i += Simd::width)
+		{
+			const typename Simd::Register y = Simd::Multiply(Simd::Load(_left.y.data() + i), Simd::Load(_right.y.data() + i));
+
+			Simd::Store(_result.data() + i, Simd::MultiplyAdd(Simd::Load(_left.x.data() + i), Simd::Load(_right.x.data() + i), y));
+		}
+	}
+
+	for (; i < _result.size(); ++i)
+	{
+		_result[i] = (_left.x[i] * _right.x[i]) + (_left.y[i] * _right.y[i]);
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns the cross product of each vector of _left with the vector of _right at the same index
+*/
+template<typename _Type>
+Status BatchCross(
+	const std::span<_Type> _result,
+	const std::span<const Vector2<std::type_identity_t<_Type>>> _left,
+	const std::span<const Vector2<std::type_identity_t<_Type>>> _right
+)
+{
+	SLR_ASSERT_ERROR(_left.size() == _result.size() && _right.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	const _Type* left = Vector2BatchImplementation::GetComponents(_left);
+	const _Type* right = Vector2BatchImplementation::GetComponents(_right);
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		for (; i + Simd::width <= _result.size(); i += Simd::width)
+		{
+			// Swapping the components of the right vectors gives (x * other.y, y * other.x) pairs
+			const typename Simd::Register products0 = Simd::Multiply(Simd::Load(left + 2 * i), Simd::SwapPairs(Simd::Load(right + 2 * i)));
+			const typename Simd::Register products1 = Simd::Multiply(Simd::Load(left + 2 * i + Simd::width), Simd::SwapPairs(Simd::Load(right + 2 * i + Simd::width)));
+
+			Simd::Store(_result.data() + i, Simd::SubtractPairs(products0, products1));
+		}
+	}
+
+	for (; i < _result.size(); ++i)
+	{
+		_result[i] = (_left[i].x * _right[i].y) - (_left[i].y * _right[i].x);
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns the cross product of each vector of _left with the vector of _right at the same index
+*/
+template<typename _Type>
+Status BatchCross(
+	const std::span<_Type> _result,
+	const Vector2SoA<const std::type_identity_t<_Type>>& _left,
+	const Vector2SoA<const std::type_identity_t<_Type>>& _right
+)
+{
+	SLR_ASSERT_ERROR(_left.IsValid() && _right.IsValid(), "Batch component arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(_left.GetSize() == _result.size() && _right.GetSize() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		for (; i + Simd::width <= _result.size(); i += Simd::width)
+		{
+			const typename Simd::Register xy = Simd::Multiply(Simd::Load(_left.x.data() + i), Simd::Load(_right.y.data() + i));
+			const typename Simd::Register yx = Simd::Multiply(Simd::Load(_left.y.data() + i), Simd::Load(_right.x.data() + i));
+
+			Simd::Store(_result.data() + i, Simd::Subtract(xy, yx));
+		}
+	}
+
+	for (; i < _result.size(); ++i)
+	{
+		_result[i] = (_left.x[i] * _right.y[i]) - (_left.y[i] * _right.x[i]);
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns the magnitude of each vector of _values
+*/
+template<typename _Type>
+Status BatchMagnitude(const std::span<_Type> _result, const std::span<const Vector2<std::type_identity_t<_Type>>> _values)
+{
+	SLR_ASSERT_ERROR(_values.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	const _Type* values = Vector2BatchImplementation::GetComponents(_values);
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		for (; i + Simd::width <= _result.size(); i += Simd::width)
+		{
+			const typename Simd::Register values0 = Simd::Load(values + 2 * i);
+			const typename Simd::Register values1 = Simd::Load(values + 2 * i + Simd::width);
+
+			Simd::Store(_result.data() + i, Simd::Sqrt(Simd::AddPairs(Simd::Multiply(values0, values0), Simd::Multiply(values1, values1))));
+		}
+	}
+
+	for (; i < _result.size(); ++i)
+	{
+		Hypot(_result[i], _values[i].x, _values[i].y);
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns the magnitude of each vector of _values
+* When FMA is available, the results may differ from Vector2::Magnitude(...) in the last bit
+*/
+template<typename _Type>
+Status BatchMagnitude(const std::span<_Type> _result, const Vector2SoA<const std::type_identity_t<_Type>>& _values)
+{
+	SLR_ASSERT_ERROR(_values.IsValid(), "Batch component arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(_values.GetSize() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		for (; i + Simd::width <= _result.size(); i += Simd::width)
+		{
+			const typename Simd::Register x = Simd::Load(_values.x.data() + i);
+			const typename Simd::Register y = Simd::Load(_values.y.data() + i);
+
+			Simd::Store(_result.data() + i, Simd::Sqrt(Simd::MultiplyAdd(x, x, Simd::Multiply(y, y))));
+		}
+	}
+
+	for (; i < _result.size(); ++i)
+	{
+		Hypot(_result[i], _values.x[i], _values.y[i]);
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Normalizes each vector of _values
+* Unlike Vector2::Normalized(...), there is no branch per vector; any vector with a magnitude of zero is written as a zero
+* vector, and the function returns Status::FAIL once the whole array has been processed
+* _result may be the same array as _values
+*/
+template<typename _Type>
+Status BatchNormalize(std::span<Vector2<_Type>> _result, const std::span<const Vector2<std::type_identity_t<_Type>>> _values)
+{
+	SLR_ASSERT_ERROR(_values.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	_Type* result = Vector2BatchImplementation::GetComponents(_result);
+	const _Type* values = Vector2BatchImplementation::GetComponents(_values);
+
+	// Whether any of the vectors have a magnitude of zero
+	bool isAnyZero = false;
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		const typename Simd::Register one = Simd::Broadcast(1);
+		typename Simd::Register zeroMask = Simd::Zero();
+
+		// Each iteration processes one register of interleaved components, which is half a register of vectors
+		for (; 2 * i + Simd::width <= 2 * _result.size(); i += Simd::width / 2)
+		{
+			const typename Simd::Register components = Simd::Load(values + 2 * i);
+			const typename Simd::Register squares = Simd::Multiply(components, components);
+
+			// Adding the swapped squares puts the magnitude squared into both components of each vector
+			const typename Simd::Register magnitude = Simd::Sqrt(Simd::Add(squares, Simd::SwapPairs(squares)));
+			const typename Simd::Register isZero = Simd::IsZero(magnitude);
+
+			zeroMask = Simd::Or(zeroMask, isZero);
+
+			Simd::Store(result + 2 * i, Simd::ZeroWhere(isZero, Simd::Multiply(components, Simd::Divide(one, magnitude))));
+		}
+
+		isAnyZero = Simd::IsAny(zeroMask);
+	}
+
+	for (; i < _result.size(); ++i)
+	{
+		_Type magnitude;
+		Hypot(magnitude, _values[i].x, _values[i].y);
+
+		if (magnitude == 0)
+		{
+			isAnyZero = true;
+			_result[i] = Vector2<_Type>(0, 0);
+
+			continue;
+		}
+
+		const _Type inverseMagnitude = _Type(1) / magnitude;
+
+		_result[i] = Vector2<_Type>(_values[i].x * inverseMagnitude, _values[i].y * inverseMagnitude);
+	}
+
+	SLR_ASSERT_ERROR(!isAnyZero, "Magnitude resulted to zero and therefore cannot be normalized")
+	{
+		return Status::FAIL;
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Normalizes each vector of _values
+* Any vector with a magnitude of zero is written as a zero vector, and the function returns Status::FAIL once the whole array
+* has been processed
+* _result may be the same arrays as _values
+*/
+template<typename _Type>
+Status BatchNormalize(const Vector2SoA<_Type>& _result, const Vector2SoA<const std::type_identity_t<_Type>>& _values)
+{
+	SLR_ASSERT_ERROR(_result.IsValid() && _values.IsValid(), "Batch component arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(_values.GetSize() == _result.GetSize(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	// Whether any of the vectors have a magnitude of zero
+	bool isAnyZero = false;
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		const typename Simd::Register one = Simd::Broadcast(1);
+		typename Simd::Register zeroMask = Simd::Zero();
+
+		for (; i + Simd::width <= _result.GetSize(); i += Simd::width)
+		{
+			const typename Simd::Register x = Simd::Load(_values.x.data() + i);
+			const typename Simd::Register y = Simd::Load(_values.y.data() + i);
+
+			const typename Simd::Register magnitude = Simd::Sqrt(Simd::MultiplyAdd(x, x, Simd::Multiply(y, y)));
+			const typename Simd::Register isZero = Simd::IsZero(magnitude);
+			const typename Simd::Register inverseMagnitude = Simd::Divide(one, magnitude);
+
+			zeroMask = Simd::Or(zeroMask, isZero);
+
+			Simd::Store(_result.x.data() + i, Simd::ZeroWhere(isZero, Simd::Multiply(x, inverseMagnitude)));
+			Simd::Store(_result.y.data() + i, Simd::ZeroWhere(isZero, Simd::Multiply(y, inverseMagnitude)));
+		}
+
+		isAnyZero = Simd::IsAny(zeroMask);
+	}
+
+	for (; i < _result.GetSize(); ++i)
+	{
+		_Type magnitude;
+		Hypot(magnitude, _values.x[i], _values.y[i]);
+
+		if (magnitude == 0)
+		{
+			isAnyZero = true;
+			_result.x[i] = 0;
+			_result.y[i] = 0;
+
+			continue;
+		}
+
+		const _Type inverseMagnitude = _Type(1) / magnitude;
+
+		_result.x[i] = _values.x[i] * inverseMagnitude;
+		_result.y[i] = _values.y[i] * inverseMagnitude;
+	}
+
+	SLR_ASSERT_ERROR(!isAnyZero, "Magnitude resulted to zero and therefore cannot be normalized")
+	{
+		return Status::FAIL;
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Rotates each vector of _values anticlockwise by _angle, in radians
+* The sine and cosine are calculated once by SinCos(...)
+* _result may be the same array as _values
+*/
+template<typename _Type>
+Status BatchRotate(
+	std::span<Vector2<_Type>> _result,
+	const std::span<const Vector2<std::type_identity_t<_Type>>> _values,
+	const std::type_identity_t<_Type> _angle
+)
+{
+	static_assert(std::is_floating_point<_Type>::value, "Only floating point vectors can be rotated");
+
+	SLR_ASSERT_ERROR(_values.size() == _result.size(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	_Type sine;
+	_Type cosine;
+	SinCos(sine, cosine, _angle);
+
+	_Type* result = Vector2BatchImplementation::GetComponents(_result);
+	const _Type* values = Vector2BatchImplementation::GetComponents(_values);
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		const typename Simd::Register cosines = Simd::Broadcast(cosine);
+		const typename Simd::Register sines = Simd::BroadcastPair(-sine, sine);
+
+		// Each (x, y) pair becomes (x * cos - y * sin, y * cos + x * sin), using the swapped (y, x) pairs for the sine terms
+		for (; 2 * i + Simd::width <= 2 * _result.size(); i += Simd::width / 2)
+		{
+			const typename Simd::Register components = Simd::Load(values + 2 * i);
+
+			Simd::Store(result + 2 * i, Simd::MultiplyAdd(Simd::SwapPairs(components), sines, Simd::Multiply(components, cosines)));
+		}
+	}
+
+	for (; i < _result.size(); ++i)
+	{
+		const Vector2<_Type> value = _values[i];
+
+		_result[i] = Vector2<_Type>((value.x * cosine) - (value.y * sine), (value.y * cosine) + (value.x * sine));
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Rotates each vector of _values anticlockwise by _angle, in radians
+* The sine and cosine are calculated once by SinCos(...)
+* _result may be the same arrays as _values
+*/
+template<typename _Type>
+Status BatchRotate(
+	const Vector2SoA<_Type>& _result,
+	const Vector2SoA<const std::type_identity_t<_Type>>& _values,
+	const std::type_identity_t<_Type> _angle
+)
+{
+	static_assert(std::is_floating_point<_Type>::value, "Only floating point vectors can be rotated");
+
+	SLR_ASSERT_ERROR(_result.IsValid() && _values.IsValid(), "Batch component arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(_values.GetSize() == _result.GetSize(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	_Type sine;
+	_Type cosine;
+	SinCos(sine, cosine, _angle);
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		const typename Simd::Register sines = Simd::Broadcast(sine);
+		const typename Simd::Register cosines = Simd::Broadcast(cosine);
+
+		for (; i + Simd::width <= _result.GetSize(); i += Simd::width)
+		{
+			const typename Simd::Register x = Simd::Load(_values.x.data() + i);
+			const typename Simd::Register y = Simd::Load(_values.y.data() + i);
+
+			Simd::Store(_result.x.data() + i, Simd::Subtract(Simd::Multiply(x, cosines), Simd::Multiply(y, sines)));
+			Simd::Store(_result.y.data() + i, Simd::MultiplyAdd(x, sines, Simd::Multiply(y, cosines)));
+		}
+	}
+
+	for (; i < _result.GetSize(); ++i)
+	{
+		const _Type x = _values.x[i];
+		const _Type y = _values.y[i];
+
+		_result.x[i] = (x * cosine) - (y * sine);
+		_result.y[i] = (y * cosine) + (x * sine);
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Rotates each vector of _values anticlockwise by the angle at the same index of _angles, in radians
+* The sines and cosines are calculated as by BatchSinCos(...)
+* _result may be the same arrays as _values
+*/
+template<typename _Type>
+Status BatchRotate(
+	const Vector2SoA<_Type>& _result,
+	const Vector2SoA<const std::type_identity_t<_Type>>& _values,
+	const std::span<const std::type_identity_t<_Type>> _angles
+)
+{
+	static_assert(std::is_floating_point<_Type>::value, "Only floating point vectors can be rotated");
+
+	SLR_ASSERT_ERROR(_result.IsValid() && _values.IsValid(), "Batch component arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(_values.GetSize() == _result.GetSize() && _angles.size() == _result.GetSize(), "Batch arrays must be the same size")
+	{
+		return Status::FAIL;
+	}
+
+	size i = 0;
+
+	if constexpr (SimdBatch<_Type>::isEnabled)
+	{
+		using Simd = SimdBatch<_Type>;
+
+		for (; i + Simd::width <= _result.GetSize(); i += Simd::width)
+		{
+			typename Simd::Register sines;
+			typename Simd::Register cosines;
+
+			TrigonometryImplementation::SinCos<Simd, _Type>(sines, cosines, Simd::Load(_angles.data() + i));
+
+			const typename Simd::Register x = Simd::Load(_values.x.data() + i);
+			const typename Simd::Register y = Simd::Load(_values.y.data() + i);
+
+			Simd::Store(_result.x.data() + i, Simd::Subtract(Simd::Multiply(x, cosines), Simd::Multiply(y, sines)));
+			Simd::Store(_result.y.data() + i, Simd::MultiplyAdd(x, sines, Simd::Multiply(y, cosines)));
+		}
+	}
+
+	for (; i < _result.GetSize(); ++i)
+	{
+		_Type sine;
+		_Type cosine;
+		SinCos(sine, cosine, _angles[i]);
+
+		const _Type x = _values.x[i];
+		const _Type y = _values.y[i];
+
+		_result.x[i] = (x * cosine) - (y * sine);
+		_result.y[i] = (y * cosine) + (x * sine);
+	}
+
+	return Status::SUCCESS;
+}
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MATH_VECTOR2BATCH
\ No newline at end of file
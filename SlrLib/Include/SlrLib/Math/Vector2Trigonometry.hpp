@@ -0,0 +1,67 @@
+/**
+* The Vector2 operations which depend on trigonometry
+* These are kept separate from Vector2.hpp so that including Vector2 doesn't pull in the trigonometry approximations and the
+* SIMD headers they need.
+*/
+
+#pragma once
+#ifndef SLR_MATH_VECTOR2TRIGONOMETRY
+#define SLR_MATH_VECTOR2TRIGONOMETRY
+
+#include <type_traits>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Math/Trigonometry.hpp"
+#include "SlrLib/Math/Vector2.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* Returns _vector rotated anticlockwise by _angle, in radians
+* The sine and cosine are approximated; refer to SinCos(...) for the error bounds
+*/
+template<typename _Type>
+inline Status Rotate(SLR_RETURN(Vector2<_Type>) _result, const Vector2<_Type>& _vector, const std::type_identity_t<_Type> _angle)
+{
+	static_assert(std::is_floating_point<_Type>::value, "Only floating point vectors can be rotated");
+
+	_Type sine;
+	_Type cosine;
+	SinCos(sine, cosine, _angle);
+
+	_result = Vector2<_Type>((_vector.x * cosine) - (_vector.y * sine), (_vector.x * sine) + (_vector.y * cosine));
+
+	return Status::SUCCESS;
+}
+
+/**
+* Returns the angle of _vector anticlockwise from the positive x axis, in radians within [-pi, pi]
+* The angle is approximated; refer to Atan2(...) for the error bounds
+*/
+template<typename _Type>
+inline Status Angle(SLR_RETURN(_Type) _result, const Vector2<_Type>& _vector)
+{
+	static_assert(std::is_floating_point<_Type>::value, "Only floating point vectors have an angle");
+
+	return Atan2(_result, _vector.y, _vector.x);
+}
+
+/**
+* Returns the unit vector at _angle anticlockwise from the positive x axis, in radians
+* The sine and cosine are approximated; refer to SinCos(...) for the error bounds
+*/
+template<typename _Type>
+inline Status FromAngle(SLR_RETURN(Vector2<_Type>) _result, const _Type _angle)
+{
+	static_assert(std::is_floating_point<_Type>::value, "Only floating point vectors can be made from an angle");
+
+	SinCos(_result.y, _result.x, _angle);
+
+	return Status::SUCCESS;
+}
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MATH_VECTOR2TRIGONOMETRY
\ No newline at end of file
@@ -0,0 +1,520 @@
+#pragma once
+#ifndef SLR_MATH_VECTOR3
+#define SLR_MATH_VECTOR3
+
+#include <type_traits>
+
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/SimdVector4.hpp"
+#include "SlrLib/Math/Functions.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* The memory layout of a Vector3
+*/
+enum class Vector3Layout : word
+{
+	// The x, y and z components are tightly packed
+	PACKED,
+
+	// The x, y and z components are followed by an unused padding component, and the vector is aligned to the size of four
+	// components, so it can be held within a single SIMD register in the same way as a Vector4
+	PADDED
+};
+
+/**
+* The components of a Vector3 for a given layout
+* These are separate from Vector3 so that only the padded layout holds the padding component
+*/
+template<typename _Type, Vector3Layout _Layout>
+struct Vector3Components;
+
+/**
+* The components of a packed Vector3
+*/
+template<typename _Type>
+struct Vector3Components<_Type, Vector3Layout::PACKED>
+{
+	/**
+	* The x component of the vector
+	*/
+	_Type x;
+
+	/**
+	* The y component of the vector
+	*/
+	_Type y;
+
+	/**
+	* The z component of the vector
+	*/
+	_Type z;
+};
+
+/**
+* The components of a padded Vector3
+*/
+template<typename _Type>
+struct alignas(4 * sizeof(_Type)) Vector3Components<_Type, Vector3Layout::PADDED>
+{
+	/**
+	* The x component of the vector
+	*/
+	_Type x;
+
+	/**
+	* The y component of the vector
+	*/
+	_Type y;
+
+	/**
+	* The z component of the vector
+	*/
+	_Type z;
+
+	/**
+	* Unused
+	* This is set to 0 on construction, but isn't kept at any particular value by arithmetic, and is ignored by comparisons,
+	* the dot product, and the magnitude
+	*/
+	_Type padding = 0;
+};
+
+/**
+* A three component vector
+* With Vector3Layout::PADDED, Vector3<float> is held within a single SSE register, and Vector3<double> within a single AVX
+* register when available, so component-wise arithmetic compiles to single instructions. Constant evaluation always uses the
+* scalar code.
+*/
+template<typename _Type, Vector3Layout _Layout = Vector3Layout::PACKED>
+struct Vector3 : Vector3Components<_Type, _Layout>
+{
+	static_assert(std::is_arithmetic<_Type>::value, "Type of vector template must be numeric");
+
+	using Vector3Components<_Type, _Layout>::x;
+	using Vector3Components<_Type, _Layout>::y;
+	using Vector3Components<_Type, _Layout>::z;
+
+	/**
+	* Default constructor
+	* Default initializes the x, y and z components of the vector to 0
+	*/
+	constexpr Vector3() : Vector3Components<_Type, _Layout>{ 0, 0, 0 } {}
+
+	/**
+	* Constructor
+	* Takes one value which is assigned to the x, y and z components
+	*/
+	constexpr Vector3(const _Type& _value) : Vector3Components<_Type, _Layout>{ _value, _value, _value } {}
+
+	/**
+	* Constructor
+	* Takes three values to respectively assign to the x, y and z components
+	*/
+	constexpr Vector3(const _Type& _x, const _Type& _y, const _Type& _z) : Vector3Components<_Type, _Layout>{ _x, _y, _z } {}
+
+	/**
+	* Constructor
+	* Takes an instance of a vector and copies its data
+	*/
+	constexpr Vector3(const Vector3& _other) : Vector3Components<_Type, _Layout>{ _other.x, _other.y, _other.z } {}
+
+	/**
+	* Assignment operator
+	* Takes a value and assigns it to the x, y and z components
+	*/
+	constexpr Vector3& operator=(const _Type& _value) { x = _value; y = _value; z = _value; return *this; }
+
+	/**
+	* Assignment operator
+	* Takes an instance of a vector and copies its data
+	*/
+	constexpr Vector3& operator=(const Vector3& _rhs) { x = _rhs.x; y = _rhs.y; z = _rhs.z; return *this; }
+
+	/**
+	* Equal to operator
+	* Returns true if the given vector is equal to this instance
+	* The x, y and z components are checked for equality
+	*/
+	constexpr bool operator==(const Vector3& _rhs) const { return _rhs.x == x && _rhs.y == y && _rhs.z == z; }
+
+	/**
+	* Not equal to operator
+	* Returns true is the given vector is not equal to this instance
+	* The x, y and z components are checked for inequality
+	*/
+	constexpr bool operator!=(const Vector3& _rhs) const { return _rhs.x != x || _rhs.y != y || _rhs.z != z; }
+
+	/**
+	* Unary plus operator
+	*/
+	constexpr Vector3 operator+() const { return Vector3(+x, +y, +z); }
+
+	/**
+	* Unary negation operator
+	* Returns a vector where the x, y and z components are negated
+	*/
+	constexpr Vector3 operator-() const
+	{
+		if constexpr (isSimd && std::is_floating_point<_Type>::value)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return FromRegister(Simd::Negate(ToRegister()));
+			}
+		}
+
+		return Vector3(-x, -y, -z);
+	}
+
+	/**
+	* Pre-increment operator
+	* Increments the x, y and z components of the vector and returns the result as a reference
+	*/
+	constexpr Vector3& operator++() { ++x; ++y; ++z; return *this; }
+
+	/**
+	* Pre-decrement operator
+	* Decrements the x, y and z components of the vector and returns the result as a reference
+	*/
+	constexpr Vector3& operator--() { --x; --y; --z; return *this; }
+
+	/**
+	* Post-increment operator
+	* Increments the x, y and z components of the vector but returns the result prior to incrementation
+	*/
+	constexpr Vector3 operator++(int) { Vector3 temp = *this; ++x; ++y; ++z; return temp; }
+
+	/**
+	* Post-decrement operator
+	* Decrements the x, y and z components of the vector but returns the result prior to decrementation
+	*/
+	constexpr Vector3 operator--(int) { Vector3 temp = *this; --x; --y; --z; return temp; }
+
+	/**
+	*
+	*/
+	constexpr Vector3 operator+(const Vector3& _rhs) const
+	{
+		if constexpr (isSimd)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return FromRegister(Simd::Add(ToRegister(), _rhs.ToRegister()));
+			}
+		}
+
+		return Vector3(x + _rhs.x, y + _rhs.y, z + _rhs.z);
+	}
+
+	/**
+	*
+	*/
+	constexpr Vector3 operator-(const Vector3& _rhs) const
+	{
+		if constexpr (isSimd)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return FromRegister(Simd::Subtract(ToRegister(), _rhs.ToRegister()));
+			}
+		}
+
+		return Vector3(x - _rhs.x, y - _rhs.y, z - _rhs.z);
+	}
+
+	/**
+	*
+	*/
+	constexpr Vector3 operator*(const Vector3& _rhs) const
+	{
+		if constexpr (isSimd)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return FromRegister(Simd::Multiply(ToRegister(), _rhs.ToRegister()));
+			}
+		}
+
+		return Vector3(x * _rhs.x, y * _rhs.y, z * _rhs.z);
+	}
+
+	/**
+	*
+	*/
+	constexpr Vector3 operator/(const Vector3& _rhs) const
+	{
+		if constexpr (isSimd)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return FromRegister(Simd::Divide3(ToRegister(), _rhs.ToRegister()));
+			}
+		}
+
+		return Vector3(x / _rhs.x, y / _rhs.y, z / _rhs.z);
+	}
+
+	/**
+	*
+	*/
+	constexpr Vector3 operator+(const _Type& _rhs) const { return *this + Vector3(_rhs); }
+
+	/**
+	*
+	*/
+	constexpr Vector3 operator-(const _Type& _rhs) const { return *this - Vector3(_rhs); }
+
+	/**
+	*
+	*/
+	constexpr Vector3 operator*(const _Type& _rhs) const { return *this * Vector3(_rhs); }
+
+	/**
+	*
+	*/
+	constexpr Vector3 operator/(const _Type& _rhs) const { return *this / Vector3(_rhs); }
+
+	/**
+	*
+	*/
+	constexpr Vector3& operator+=(const Vector3& _rhs) { return *this = *this + _rhs; }
+
+	/**
+	*
+	*/
+	constexpr Vector3& operator-=(const Vector3& _rhs) { return *this = *this - _rhs; }
+
+	/**
+	*
+	*/
+	constexpr Vector3& operator*=(const Vector3& _rhs) { return *this = *this * _rhs; }
+
+	/**
+	*
+	*/
+	constexpr Vector3& operator/=(const Vector3& _rhs) { return *this = *this / _rhs; }
+
+	/**
+	*
+	*/
+	constexpr Vector3& operator+=(const _Type& _rhs) { return *this = *this + Vector3(_rhs); }
+
+	/**
+	*
+	*/
+	constexpr Vector3& operator-=(const _Type& _rhs) { return *this = *this - Vector3(_rhs); }
+
+	/**
+	*
+	*/
+	constexpr Vector3& operator*=(const _Type& _rhs) { return *this = *this * Vector3(_rhs); }
+
+	/**
+	*
+	*/
+	constexpr Vector3& operator/=(const _Type& _rhs) { return *this = *this / Vector3(_rhs); }
+
+	/**
+	* Returns the dot product of two vectors
+	*/
+	constexpr Status Dot(SLR_RETURN(_Type) _result, const Vector3& _other) const
+	{
+		if constexpr (isSimd)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				_result = Simd::Dot3(ToRegister(), _other.ToRegister());
+
+				return Status::SUCCESS;
+			}
+		}
+
+		// Calculate the dot product of the two vectors
+		_result = (this->x * _other.x) + (this->y * _other.y) + (this->z * _other.z);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the cross product of two vectors
+	*/
+	constexpr Status Cross(SLR_RETURN(Vector3) _result, const Vector3& _other) const
+	{
+		if constexpr (isSimd && Simd::hasCross)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				_result = FromRegister(Simd::Cross3(ToRegister(), _other.ToRegister()));
+
+				return Status::SUCCESS;
+			}
+		}
+
+		// Calculate the cross product of the two vectors
+		_result = Vector3(
+			(this->y * _other.z) - (this->z * _other.y),
+			(this->z * _other.x) - (this->x * _other.z),
+			(this->x * _other.y) - (this->y * _other.x)
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the magnitude of the vector
+	*/
+	constexpr Status Magnitude(SLR_RETURN(_Type) _result) const
+	{
+		// Calculate the magnitude squared
+		_Type magnitudeSquared;
+		this->MagnitudeSquared(magnitudeSquared);
+
+		// Assign the return value for the square root of the magnitude squared
+		Status sqrtStatus = Sqrt(_result, magnitudeSquared);
+
+		SLR_ASSERT_ERROR(sqrtStatus == Status::SUCCESS, "Could not calculate square root of magnitude squared")
+		{
+			return Status::FAIL;
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the magnitude squared of the vector
+	* This is an option for efficiency so that the user doesn't take the magnitude (which has the square root applied) then
+	* square it
+	*/
+	constexpr Status MagnitudeSquared(SLR_RETURN(_Type) _result) const
+	{
+		// The magnitude squared is the dot product of the vector with itself
+		return this->Dot(_result, *this);
+	}
+
+	/**
+	* Returns the normalized version of the vector
+	*/
+	constexpr Status Normalized(SLR_RETURN(Vector3) _result) const
+	{
+		// Get the magnitude of the vector
+		_Type magnitude;
+		Status magnitudeStatus = this->Magnitude(magnitude);
+
+		SLR_ASSERT_ERROR(magnitudeStatus == Status::SUCCESS, "Could not calculate the magnitude to normalize vector")
+		{
+			return Status::FAIL;
+		}
+
+		SLR_ASSERT_ERROR(magnitude != 0, "Magnitude resulted to zero and therefore cannot be normalized")
+		{
+			return Status::FAIL;
+		}
+
+		// Get the inverse magnitude of the vector
+		const _Type inverseMagnitude = _Type(1) / magnitude;
+
+		// Normalize the vector and return it
+		_result = *this * inverseMagnitude;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a vector of a different data type
+	* The layout of the vector is kept
+	*/
+	template<typename _ParseType>
+	constexpr Status AsType(SLR_RETURN(Vector3<_ParseType, _Layout>) _result) const
+	{
+		// Convert the components to the new type
+		_result = Vector3<_ParseType, _Layout>(
+			static_cast<_ParseType>(this->x),
+			static_cast<_ParseType>(this->y),
+			static_cast<_ParseType>(this->z)
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a vector with a different layout
+	*/
+	template<Vector3Layout _ParseLayout>
+	constexpr Status AsLayout(SLR_RETURN(Vector3<_Type, _ParseLayout>) _result) const
+	{
+		_result = Vector3<_Type, _ParseLayout>(this->x, this->y, this->z);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a unit vector
+	* The return value is (1, 1, 1) normalized
+	*/
+	static constexpr Status GetUnitVector(SLR_RETURN(Vector3) _result)
+	{
+		// Get a unit vector
+		Status normalizedStatus = Vector3(1, 1, 1).Normalized(_result);
+		SLR_ASSERT_ERROR(normalizedStatus == Status::SUCCESS, "Could not normaize vector")
+		{
+			return Status::FAIL;
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a zero vector
+	* The x, y and z components are assigned to 0
+	*/
+	static constexpr Status GetZeroVector(SLR_RETURN(Vector3) _result)
+	{
+		_result = Vector3(0, 0, 0);
+
+		return Status::SUCCESS;
+	}
+
+private:
+	/**
+	* The SIMD register the components are held within, if the layout is padded and there is one for _Type
+	*/
+	using Simd = SimdVector4<_Type>;
+
+	/**
+	* Whether the SIMD code is used outside of constant evaluation
+	*/
+	static constexpr bool isSimd = (_Layout == Vector3Layout::PADDED) && Simd::isEnabled;
+
+	/**
+	* Loads the components, and the padding, into a SIMD register
+	*/
+	inline auto ToRegister() const
+	{
+		return Simd::Load(&this->x);
+	}
+
+	/**
+	* Creates a vector from the components within a SIMD register
+	*/
+	template<typename _Register>
+	static inline Vector3 FromRegister(const _Register _value)
+	{
+		Vector3 result;
+		Simd::Store(&result.x, _value);
+
+		return result;
+	}
+};
+
+static_assert(sizeof(Vector3<float>) == 3 * sizeof(float), "A packed Vector3 must not contain any padding");
+static_assert(sizeof(Vector3<float, Vector3Layout::PADDED>) == 4 * sizeof(float), "A padded Vector3 must be four components");
+
+using Vector3u32 = Vector3<u32>;
+using Vector3i32 = Vector3<i32>;
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MATH_VECTOR3
\ No newline at end of file
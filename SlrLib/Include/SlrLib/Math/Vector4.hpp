@@ -0,0 +1,455 @@
+#pragma once
+#ifndef SLR_MATH_VECTOR4
+#define SLR_MATH_VECTOR4
+
+#include <type_traits>
+
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Internal/SimdVector4.hpp"
+#include "SlrLib/Math/Functions.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* A four component vector
+* Vector4<float> is held within a single SSE register, and Vector4<double> within a single AVX register when available, so
+* component-wise arithmetic compiles to single instructions. Constant evaluation always uses the scalar code.
+*/
+template<typename _Type>
+struct alignas(4 * sizeof(_Type)) Vector4
+{
+	static_assert(std::is_arithmetic<_Type>::value, "Type of vector template must be numeric");
+
+	/**
+	* The x component of the vector
+	*/
+	_Type x;
+
+	/**
+	* The y component of the vector
+	*/
+	_Type y;
+
+	/**
+	* The z component of the vector
+	*/
+	_Type z;
+
+	/**
+	* The w component of the vector
+	*/
+	_Type w;
+
+	/**
+	* Default constructor
+	* Default initializes the x, y, z and w components of the vector to 0
+	*/
+	constexpr Vector4() : x(0), y(0), z(0), w(0) {}
+
+	/**
+	* Constructor
+	* Takes one value which is assigned to the x, y, z and w components
+	*/
+	constexpr Vector4(const _Type& _value) : x(_value), y(_value), z(_value), w(_value) {}
+
+	/**
+	* Constructor
+	* Takes four values to respectively assign to the x, y, z and w components
+	*/
+	constexpr Vector4(const _Type& _x, const _Type& _y, const _Type& _z, const _Type& _w) : x(_x), y(_y), z(_z), w(_w) {}
+
+	/**
+	* Constructor
+	* Takes an instance of a vector and copies its data
+	*/
+	constexpr Vector4(const Vector4& _other) : x(_other.x), y(_other.y), z(_other.z), w(_other.w) {}
+
+	/**
+	* Assignment operator
+	* Takes a value and assigns it to the x, y, z and w components
+	*/
+	constexpr Vector4& operator=(const _Type& _value) { x = _value; y = _value; z = _value; w = _value; return *this; }
+
+	/**
+	* Assignment operator
+	* Takes an instance of a vector and copies its data
+	*/
+	constexpr Vector4& operator=(const Vector4& _rhs) { x = _rhs.x; y = _rhs.y; z = _rhs.z; w = _rhs.w; return *this; }
+
+	/**
+	* Equal to operator
+	* Returns true if the given vector is equal to this instance
+	* The x, y, z and w components are checked for equality
+	*/
+	constexpr bool operator==(const Vector4& _rhs) const { return _rhs.x == x && _rhs.y == y && _rhs.z == z && _rhs.w == w; }
+
+	/**
+	* Not equal to operator
+	* Returns true is the given vector is not equal to this instance
+	* The x, y, z and w components are checked for inequality
+	*/
+	constexpr bool operator!=(const Vector4& _rhs) const { return _rhs.x != x || _rhs.y != y || _rhs.z != z || _rhs.w != w; }
+
+	/**
+	* Unary plus operator
+	*/
+	constexpr Vector4 operator+() const { return Vector4(+x, +y, +z, +w); }
+
+	/**
+	* Unary negation operator
+	* Returns a vector where the x, y, z and w components are negated
+	*/
+	constexpr Vector4 operator-() const
+	{
+		if constexpr (isSimd && std::is_floating_point<_Type>::value)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return FromRegister(Simd::Negate(ToRegister()));
+			}
+		}
+
+		return Vector4(-x, -y, -z, -w);
+	}
+
+	/**
+	* Pre-increment operator
+	* Increments the x, y, z and w components of the vector and returns the result as a reference
+	*/
+	constexpr Vector4& operator++() { ++x; ++y; ++z; ++w; return *this; }
+
+	/**
+	* Pre-decrement operator
+	* Decrements the x, y, z and w components of the vector and returns the result as a reference
+	*/
+	constexpr Vector4& operator--() { --x; --y; --z; --w; return *this; }
+
+	/**
+	* Post-increment operator
+	* Increments the x, y, z and w components of the vector but returns the result prior to incrementation
+	*/
+	constexpr Vector4 operator++(int) { Vector4 temp = *this; ++x; ++y; ++z; ++w; return temp; }
+
+	/**
+	* Post-decrement operator
+	* Decrements the x, y, z and w components of the vector but returns the result prior to decrementation
+	*/
+	constexpr Vector4 operator--(int) { Vector4 temp = *this; --x; --y; --z; --w; return temp; }
+
+	/**
+	*
+	*/
+	constexpr Vector4 operator+(const Vector4& _rhs) const
+	{
+		if constexpr (isSimd)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return FromRegister(Simd::Add(ToRegister(), _rhs.ToRegister()));
+			}
+		}
+
+		return Vector4(x + _rhs.x, y + _rhs.y, z + _rhs.z, w + _rhs.w);
+	}
+
+	/**
+	*
+	*/
+	constexpr Vector4 operator-(const Vector4& _rhs) const
+	{
+		if constexpr (isSimd)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return FromRegister(Simd::Subtract(ToRegister(), _rhs.ToRegister()));
+			}
+		}
+
+		return Vector4(x - _rhs.x, y - _rhs.y, z - _rhs.z, w - _rhs.w);
+	}
+
+	/**
+	*
+	*/
+	constexpr Vector4 operator*(const Vector4& _rhs) const
+	{
+		if constexpr (isSimd)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return FromRegister(Simd::Multiply(ToRegister(), _rhs.ToRegister()));
+			}
+		}
+
+		return Vector4(x * _rhs.x, y * _rhs.y, z * _rhs.z, w * _rhs.w);
+	}
+
+	/**
+	*
+	*/
+	constexpr Vector4 operator/(const Vector4& _rhs) const
+	{
+		if constexpr (isSimd)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				return FromRegister(Simd::Divide(ToRegister(), _rhs.ToRegister()));
+			}
+		}
+
+		return Vector4(x / _rhs.x, y / _rhs.y, z / _rhs.z, w / _rhs.w);
+	}
+
+	/**
+	*
+	*/
+	constexpr Vector4 operator+(const _Type& _rhs) const { return *this + Vector4(_rhs); }
+
+	/**
+	*
+	*/
+	constexpr Vector4 operator-(const _Type& _rhs) const { return *this - Vector4(_rhs); }
+
+	/**
+	*
+	*/
+	constexpr Vector4 operator*(const _Type& _rhs) const { return *this * Vector4(_rhs); }
+
+	/**
+	*
+	*/
+	constexpr Vector4 operator/(const _Type& _rhs) const { return *this / Vector4(_rhs); }
+
+	/**
+	*
+	*/
+	constexpr Vector4& operator+=(const Vector4& _rhs) { return *this = *this + _rhs; }
+
+	/**
+	*
+	*/
+	constexpr Vector4& operator-=(const Vector4& _rhs) { return *this = *this - _rhs; }
+
+	/**
+	*
+	*/
+	constexpr Vector4& operator*=(const Vector4& _rhs) { return *this = *this * _rhs; }
+
+	/**
+	*
+	*/
+	constexpr Vector4& operator/=(const Vector4& _rhs) { return *this = *this / _rhs; }
+
+	/**
+	*
+	*/
+	constexpr Vector4& operator+=(const _Type& _rhs) { return *this = *this + Vector4(_rhs); }
+
+	/**
+	*
+	*/
+	constexpr Vector4& operator-=(const _Type& _rhs) { return *this = *this - Vector4(_rhs); }
+
+	/**
+	*
+	*/
+	constexpr Vector4& operator*=(const _Type& _rhs) { return *this = *this * Vector4(_rhs); }
+
+	/**
+	*
+	*/
+	constexpr Vector4& operator/=(const _Type& _rhs) { return *this = *this / Vector4(_rhs); }
+
+	/**
+	* Returns the dot product of two vectors
+	*/
+	constexpr Status Dot(SLR_RETURN(_Type) _result, const Vector4& _other) const
+	{
+		if constexpr (isSimd)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				_result = Simd::Dot4(ToRegister(), _other.ToRegister());
+
+				return Status::SUCCESS;
+			}
+		}
+
+		// Calculate the dot product of the two vectors
+		_result = (this->x * _other.x) + (this->y * _other.y) + (this->z * _other.z) + (this->w * _other.w);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the cross product of the x, y and z components of two vectors
+	* The w component of the result is 0
+	*/
+	constexpr Status Cross(SLR_RETURN(Vector4) _result, const Vector4& _other) const
+	{
+		if constexpr (isSimd && Simd::hasCross)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				_result = FromRegister(Simd::Cross3(ToRegister(), _other.ToRegister()));
+				_result.w = 0;
+
+				return Status::SUCCESS;
+			}
+		}
+
+		// Calculate the cross product of the two vectors
+		_result = Vector4(
+			(this->y * _other.z) - (this->z * _other.y),
+			(this->z * _other.x) - (this->x * _other.z),
+			(this->x * _other.y) - (this->y * _other.x),
+			0
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the magnitude of the vector
+	*/
+	constexpr Status Magnitude(SLR_RETURN(_Type) _result) const
+	{
+		// Calculate the magnitude squared
+		_Type magnitudeSquared;
+		this->MagnitudeSquared(magnitudeSquared);
+
+		// Assign the return value for the square root of the magnitude squared
+		Status sqrtStatus = Sqrt(_result, magnitudeSquared);
+
+		SLR_ASSERT_ERROR(sqrtStatus == Status::SUCCESS, "Could not calculate square root of magnitude squared")
+		{
+			return Status::FAIL;
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the magnitude squared of the vector
+	* This is an option for efficiency so that the user doesn't take the magnitude (which has the square root applied) then
+	* square it
+	*/
+	constexpr Status MagnitudeSquared(SLR_RETURN(_Type) _result) const
+	{
+		// The magnitude squared is the dot product of the vector with itself
+		return this->Dot(_result, *this);
+	}
+
+	/**
+	* Returns the normalized version of the vector
+	*/
+	constexpr Status Normalized(SLR_RETURN(Vector4) _result) const
+	{
+		// Get the magnitude of the vector
+		_Type magnitude;
+		Status magnitudeStatus = this->Magnitude(magnitude);
+
+		SLR_ASSERT_ERROR(magnitudeStatus == Status::SUCCESS, "Could not calculate the magnitude to normalize vector")
+		{
+			return Status::FAIL;
+		}
+
+		SLR_ASSERT_ERROR(magnitude != 0, "Magnitude resulted to zero and therefore cannot be normalized")
+		{
+			return Status::FAIL;
+		}
+
+		// Get the inverse magnitude of the vector
+		const _Type inverseMagnitude = _Type(1) / magnitude;
+
+		// Normalize the vector and return it
+		_result = *this * inverseMagnitude;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a vector of a different data type
+	*/
+	template<typename _ParseType>
+	constexpr Status AsType(SLR_RETURN(Vector4<_ParseType>) _result) const
+	{
+		// Convert the components to the new type
+		_result = Vector4<_ParseType>(
+			static_cast<_ParseType>(this->x),
+			static_cast<_ParseType>(this->y),
+			static_cast<_ParseType>(this->z),
+			static_cast<_ParseType>(this->w)
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a unit vector
+	* The return value is (1, 1, 1, 1) normalized
+	*/
+	static constexpr Status GetUnitVector(SLR_RETURN(Vector4) _result)
+	{
+		// Get a unit vector
+		Status normalizedStatus = Vector4(1, 1, 1, 1).Normalized(_result);
+		SLR_ASSERT_ERROR(normalizedStatus == Status::SUCCESS, "Could not normaize vector")
+		{
+			return Status::FAIL;
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a zero vector
+	* The x, y, z and w components are assigned to 0
+	*/
+	static constexpr Status GetZeroVector(SLR_RETURN(Vector4) _result)
+	{
+		_result = Vector4(0, 0, 0, 0);
+
+		return Status::SUCCESS;
+	}
+
+private:
+	/**
+	* The SIMD register the components are held within, if there is one for _Type
+	*/
+	using Simd = SimdVector4<_Type>;
+
+	/**
+	* Whether the SIMD code is used outside of constant evaluation
+	*/
+	static constexpr bool isSimd = Simd::isEnabled;
+
+	/**
+	* Loads the components into a SIMD register
+	*/
+	inline auto ToRegister() const
+	{
+		return Simd::Load(&this->x);
+	}
+
+	/**
+	* Creates a vector from the components within a SIMD register
+	*/
+	template<typename _Register>
+	static inline Vector4 FromRegister(const _Register _value)
+	{
+		Vector4 result;
+		Simd::Store(&result.x, _value);
+
+		return result;
+	}
+};
+
+static_assert(sizeof(Vector4<float>) == 4 * sizeof(float), "Vector4 must not contain any padding");
+
+using Vector4u32 = Vector4<u32>;
+using Vector4i32 = Vector4<i32>;
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MATH_VECTOR4
\ No newline at end of file
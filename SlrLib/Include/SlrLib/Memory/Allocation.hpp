@@ -2,9 +2,11 @@
 #ifndef SLR_MEMORY_ALLOCATION
 #define SLR_MEMORY_ALLOCATION
 
+#include <chrono>
 #include <cstdlib>
 
 #include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/ErrorHandling/RateLimit.hpp"
 #include "SlrLib/Internal/Namespace.hpp"
 #include "SlrLib/Utilities/Macros.hpp"
 #include "SlrLib/Utilities/Types.hpp"
@@ -34,8 +36,9 @@ Status MemAlloc(SLR_RETURN(_Type*) _allocation, const size _bytes)
 	size bytesToAllocate = _bytes + sizeof(size);
 
 	// Allocate buffer
+	// Allocation failures tend to repeat in a loop, so only log them once per second
 	void* allocation = std::malloc(bytesToAllocate);
-	SLR_ASSERT_ERROR(allocation != nullptr, "Failed to allocate memory")
+	SLR_ASSERT_ERROR_LIMITED(allocation != nullptr, LogRateLimit::Interval(std::chrono::seconds(1)), "Failed to allocate memory")
 	{
 		return Status::FAIL;
 	}
@@ -79,7 +82,7 @@ Status MemRealloc(SLR_RETURN(_Type*) _allocation, const size _bytes)
 
 	// Create a new allocation
 	void* newAllocation = std::realloc(allocationPointer, newAllocationSize);
-	SLR_ASSERT_ERROR(newAllocation != nullptr, "Could not reallocate memory")
+	SLR_ASSERT_ERROR_LIMITED(newAllocation != nullptr, LogRateLimit::Interval(std::chrono::seconds(1)), "Could not reallocate memory")
 	{
 		return Status::FAIL;
 	}
@@ -137,6 +140,43 @@ Status MemSize(SLR_RETURN(size) _bytes, const _Type* _allocation)
 	return Status::SUCCESS;
 }
 
+/**
+* Ensures an allocation, allocated by MemAlloc(...) or MemRealloc(...), is at least _bytes in size
+* If _allocation is a nullptr, a new allocation is made
+* If the existing allocation is too small, it is freed and replaced with a new allocation; unlike MemRealloc(...), the
+* contents are not preserved, which avoids copying buffers which are about to be overwritten
+* An allocation which is already large enough is left untouched
+*/
+template<typename _Type = void>
+Status MemReserve(SLR_RETURN(_Type*) _allocation, const size _bytes)
+{
+	if (_allocation != nullptr)
+	{
+		size allocatedBytes;
+		MemSize(allocatedBytes, _allocation);
+
+		// The existing allocation can be reused
+		if (allocatedBytes >= _bytes)
+		{
+			return Status::SUCCESS;
+		}
+
+		Status freeStatus = MemFree<_Type>(_allocation);
+		SLR_ASSERT_ERROR(freeStatus == Status::SUCCESS, "Could not free the existing allocation")
+		{
+			return Status::FAIL;
+		}
+	}
+
+	Status allocationStatus = MemAlloc<_Type>(_allocation, _bytes);
+	SLR_ASSERT_ERROR(allocationStatus == Status::SUCCESS, "Could not allocate memory")
+	{
+		return Status::FAIL;
+	}
+
+	return Status::SUCCESS;
+}
+
 SLR_NAMESPACE_END
 
 #endif // ifndef SLR_MEMORY_ALLOCATION
\ No newline at end of file
@@ -0,0 +1,665 @@
+#pragma once
+#ifndef SLR_MEMORY_BIASEDSHAREDPOINTER
+#define SLR_MEMORY_BIASEDSHAREDPOINTER
+
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Memory/Allocation.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+struct BiasedOwnerThread;
+
+/**
+* The reference counts for an object held by BiasedShared
+* The thread which created the object (the owner) counts its references with biasedCount, which is never touched atomically,
+* and every other thread counts its references with sharedCount. sharedCount may become negative when a reference which was
+* counted by the owner is released on another thread; the true number of references is always biasedCount + sharedCount.
+* Once the owner has no biased references left, or the object is queued to the owner because sharedCount went negative, the
+* biased count is merged into sharedCount and from then on every thread uses sharedCount.
+* sharedCount stores the count in multiples of `one`, leaving the lower two bits for the `merged` and `queued` flags, so the
+* flags and the count are always read and written together.
+*/
+struct BiasedReferenceCount
+{
+	/**
+	* Flag set within sharedCount once the biased count has been merged into it
+	*/
+	static constexpr i64 merged = 1;
+
+	/**
+	* Flag set within sharedCount once the object has been queued to the owner thread to be merged
+	* While this is set, only the thread processing the queue may destroy the object
+	*/
+	static constexpr i64 queued = 2;
+
+	/**
+	* The value of a single reference within sharedCount
+	*/
+	static constexpr i64 one = 4;
+
+	/**
+	* The thread which created the object
+	* The record is kept alive for as long as this reference count exists, even if the thread has exited
+	*/
+	BiasedOwnerThread* owner = nullptr;
+
+	/**
+	* The number of references counted by the owner thread
+	* This must only ever be accessed by the owner thread
+	*/
+	size biasedCount = 0;
+
+	/**
+	* Whether the owner has merged biasedCount into sharedCount
+	* This must only ever be accessed by the owner thread; other threads read the flag within sharedCount instead
+	*/
+	bool isMerged = false;
+
+	/**
+	* The number of references counted by every thread other than the owner, along with the `merged` and `queued` flags
+	*/
+	std::atomic<i64> sharedCount = 0;
+
+	/**
+	* The next reference count within the owner's merge queue
+	*/
+	BiasedReferenceCount* nextQueued = nullptr;
+
+	/**
+	* Destroys the object and frees the allocation holding it and this reference count
+	* This is stored so the merge queue can destroy objects without knowing their type
+	*/
+	void (*destroy)(BiasedReferenceCount*) = nullptr;
+};
+
+/**
+* A record for each thread which has created an object held by BiasedShared
+* Other threads push reference counts onto `queue` when they need the owner to merge its biased count
+* The record is reference counted; the thread holds one reference while it's running and every BiasedReferenceCount owned by
+* it holds another, so the record outlives the thread if objects created by it are still alive
+*/
+struct BiasedOwnerThread
+{
+	/**
+	* The number of references to this record
+	*/
+	std::atomic<size> references = 1;
+
+	/**
+	* Whether the thread is still running
+	* Once this is false, whoever queues a reference count must process the queue themselves
+	*/
+	std::atomic<bool> isAlive = true;
+
+	/**
+	* A lock-free stack of reference counts waiting to be merged
+	*/
+	std::atomic<BiasedReferenceCount*> queue = nullptr;
+};
+
+/**
+* This class is purely to hide the implementation from the user to make it clear not to interact with anything contained
+* within
+*/
+class BiasedSharedImplementation
+{
+public:
+	/**
+	* Returns the record for the calling thread, or nullptr if the thread has not created any objects held by BiasedShared
+	* This is what is compared against BiasedReferenceCount::owner to decide whether the caller is the owner
+	*/
+	static inline BiasedOwnerThread* GetCurrentThread()
+	{
+		return BiasedSharedImplementation::currentThread;
+	}
+
+	/**
+	* Returns the record for the calling thread, creating it if this is the first object created by the thread
+	*/
+	static Status AcquireCurrentThread(SLR_RETURN(BiasedOwnerThread*) _thread);
+
+	/**
+	* Releases a reference to a thread record and frees it once no references remain
+	*/
+	static Status ReleaseThread(BiasedOwnerThread* _thread);
+
+	/**
+	* Pushes a reference count onto its owner's merge queue
+	* If the owner has already exited, the queue is processed immediately by the caller
+	*/
+	static Status Enqueue(BiasedReferenceCount* _referenceCount);
+
+	/**
+	* Merges and, if no references remain, destroys every reference count within the thread's queue
+	* This must only be called by the owner of the queue, or by any thread once the owner has exited
+	*/
+	static Status ProcessQueue(BiasedOwnerThread* _thread);
+
+	/**
+	* Called when a thread which has created objects exits
+	* Stops other threads from relying on the thread to process its queue, processes anything already queued, then releases
+	* the thread's reference to its record
+	*/
+	static Status ExitCurrentThread();
+
+private:
+	/**
+	* The record for the calling thread
+	*/
+	static thread_local inline BiasedOwnerThread* currentThread = nullptr;
+};
+
+/**
+* A shared pointer which is optimized for objects that are mostly accessed by the thread which created them
+* The creating thread updates a non-atomic reference count, while every other thread updates an atomic reference count. This
+* makes copying and destroying references on the owner thread as cheap as Shared, while still allowing references to be
+* passed to, and released on, other threads. When the owner releases its last reference, the two counts are merged and the
+* object is destroyed by whichever thread releases the final reference.
+* If another thread releases a reference which was counted by the owner, the object is queued to the owner to be merged. The
+* owner processes its queue whenever it next copies or releases a BiasedShared, when it calls ProcessBiasedMerges(), or when
+* it exits.
+*/
+template<typename _Type>
+class BiasedShared
+{
+	static_assert(!std::is_pointer<_Type>::value, "Shared pointer type cannot be a pointer");
+	static_assert(!std::is_array<_Type>::value, "Shared pointer type cannot be an array");
+
+	template<typename _Other, typename ... _Arguments>
+	friend Status CreateBiasedShared(BiasedShared<_Other>&, _Arguments&& ...);
+
+public:
+	/**
+	* Constructor
+	* Assigns referenceCount and value to be nullptr to signify this instance does not hold a reference to an object
+	*/
+	BiasedShared()
+	{
+		// Signify we are not holding a reference to an object
+		referenceCount = nullptr;
+		value = nullptr;
+	}
+
+	/**
+	* Copy constructor
+	* Add a new reference to the object being held to by _other
+	*/
+	BiasedShared(const BiasedShared& _other)
+	{
+		// Make this instance a new reference to _other
+		NewReference(_other);
+	}
+
+	/**
+	* Move constructor
+	* Take ownership of the object being held by _other
+	*/
+	BiasedShared(BiasedShared&& _other)
+	{
+		// Take the reference from _other and assign it to this instance
+		TakeReference(std::move(_other));
+	}
+
+	/**
+	* Destructor
+	* If this is holding a reference to an object, it will release the reference and delete the object if necessary
+	*/
+	~BiasedShared()
+	{
+		Status status = ReleaseReference();
+		SLR_ERROR(status == Status::SUCCESS, "Could not release reference held by biased shared pointer");
+	}
+
+	/**
+	* Copy assignment operator
+	* Releases the currently held reference, if any, and adds a new reference to the object being held by _other
+	*/
+	BiasedShared& operator=(const BiasedShared& _other)
+	{
+		if (this != &_other)
+		{
+			Status status = ReleaseReference();
+			SLR_ERROR(status == Status::SUCCESS, "Could not release reference held by biased shared pointer");
+
+			NewReference(_other);
+		}
+
+		return *this;
+	}
+
+	/**
+	* Move assignment operator
+	* Releases the currently held reference, if any, and takes ownership of the object being held by _other
+	*/
+	BiasedShared& operator=(BiasedShared&& _other)
+	{
+		if (this != &_other)
+		{
+			Status status = ReleaseReference();
+			SLR_ERROR(status == Status::SUCCESS, "Could not release reference held by biased shared pointer");
+
+			TakeReference(std::move(_other));
+		}
+
+		return *this;
+	}
+
+	/**
+	* Returns a boolean stating if this instance is holding a reference to an object, where true means it is holding a
+	* reference, and false means it is not
+	*/
+	inline Status IsHoldingReference(SLR_RETURN(bool) _isHoldingReference) const
+	{
+		_isHoldingReference = ((value != nullptr) && (referenceCount != nullptr));
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns whether the calling thread is the thread which created the object
+	* An error is logged if this function is called while not holding a reference to any object
+	*/
+	inline Status IsOwnerThread(SLR_RETURN(bool) _isOwnerThread) const
+	{
+		// Check if we're holding a reference to an object
+		bool isHoldingReference;
+		IsHoldingReference(isHoldingReference);
+		SLR_ASSERT_ERROR(isHoldingReference == true, "Not holding a reference to any object")
+		{
+			return Status::FAIL;
+		}
+
+		_isOwnerThread = (referenceCount->owner == BiasedSharedImplementation::GetCurrentThread());
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the number of references to the object
+	* The biased count can only be read by the owner thread, therefore, until the counts have been merged, this must be
+	* called from the owner thread otherwise FAIL is returned. As with any shared pointer, the result may be out of date as
+	* soon as it has been returned if other threads are copying or releasing references.
+	*/
+	inline Status GetReferenceCount(SLR_RETURN(size) _references) const
+	{
+		// Check if we're holding a reference to an object
+		bool isHoldingReference;
+		IsHoldingReference(isHoldingReference);
+		SLR_ASSERT_ERROR(isHoldingReference == true, "Not holding a reference to any object")
+		{
+			return Status::FAIL;
+		}
+
+		const i64 sharedCount = referenceCount->sharedCount.load(std::memory_order_acquire);
+		const bool isOwnerThread = (referenceCount->owner == BiasedSharedImplementation::GetCurrentThread());
+
+		SLR_ASSERT_WARNING(
+			isOwnerThread || (sharedCount & BiasedReferenceCount::merged) != 0,
+			"The reference count can only be read by the owner thread until it has been merged"
+		)
+		{
+			return Status::FAIL;
+		}
+
+		// Only the owner may read the biased count, and it is zero once merged
+		const i64 biasedCount = isOwnerThread ? static_cast<i64>(referenceCount->biasedCount) : 0;
+
+		_references = static_cast<size>(biasedCount + (sharedCount >> 2));
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns whether this instance holds the only reference to the object
+	* This never reports true while another reference exists, but it may report false when this is the only reference: until
+	* the counts have been merged, threads other than the owner cannot read the biased count, so they assume it is shared
+	*/
+	inline Status IsUnique(SLR_RETURN(bool) _isUnique) const
+	{
+		// Check if we're holding a reference to an object
+		bool isHoldingReference;
+		IsHoldingReference(isHoldingReference);
+		SLR_ASSERT_ERROR(isHoldingReference == true, "Not holding a reference to any object")
+		{
+			return Status::FAIL;
+		}
+
+		const i64 sharedCount = referenceCount->sharedCount.load(std::memory_order_acquire);
+
+		// Once merged, every reference is within the shared count
+		if ((sharedCount & BiasedReferenceCount::merged) != 0)
+		{
+			_isUnique = (sharedCount >> 2) == 1;
+		}
+		// The owner can read both counts
+		else if (referenceCount->owner == BiasedSharedImplementation::GetCurrentThread())
+		{
+			_isUnique = (static_cast<i64>(referenceCount->biasedCount) + (sharedCount >> 2)) == 1;
+		}
+		// Any other thread has to assume the owner still holds a reference
+		else
+		{
+			_isUnique = false;
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a reference to the object stored
+	*/
+	_Type& operator*()
+	{
+		return *value;
+	}
+
+	/**
+	* Returns a pointer to the object stored
+	*/
+	_Type* operator->()
+	{
+		return value;
+	}
+
+	/**
+	* Returns a const reference to the object stored
+	*/
+	const _Type& operator*() const
+	{
+		return *value;
+	}
+
+	/**
+	* Returns a const pointer to the object stored
+	*/
+	const _Type* operator->() const
+	{
+		return value;
+	}
+
+private:
+	/**
+	* A pointer to the reference counts which exist for the object
+	* If this is nullptr then this instance does not hold a reference to an object
+	* This is allocated proceeding the object, padded to the alignment of BiasedReferenceCount
+	*/
+	BiasedReferenceCount* referenceCount = nullptr;
+
+	/**
+	* A pointer to the object being contained by this shared pointer
+	*/
+	_Type* value = nullptr;
+
+	/**
+	* The offset from the start of the allocation to the reference count
+	*/
+	static constexpr size referenceCountOffset =
+		(sizeof(_Type) + alignof(BiasedReferenceCount) - 1) / alignof(BiasedReferenceCount) * alignof(BiasedReferenceCount);
+
+	/**
+	* Takes a reference from _other and assign it ourself
+	* We do not increment nor decrement the reference count because we are purely taking ownership
+	*/
+	inline Status TakeReference(BiasedShared&& _other)
+	{
+		// Copy the pointer to the reference count
+		this->referenceCount = _other.referenceCount;
+
+		// Copy the pointer to the object
+		this->value = _other.value;
+
+		// Set the members of _other to nullptr so it doesn't potentially delete the once it's being destructed
+		_other.referenceCount = nullptr;
+		_other.value = nullptr;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Create a new reference to the object pointed to by _other.value and increment the reference count
+	* _other may not be holding a reference to any object, so we must check for that
+	*/
+	inline Status NewReference(const BiasedShared& _other)
+	{
+		// Copy the pointer to the reference count
+		this->referenceCount = _other.referenceCount;
+
+		// Copy the pointer to the object
+		this->value = _other.value;
+
+		// Check if this is holding a valid reference
+		bool isHoldingReference;
+		IsHoldingReference(isHoldingReference);
+
+		if (!isHoldingReference)
+		{
+			return Status::SUCCESS;
+		}
+
+		BiasedOwnerThread* currentThread = BiasedSharedImplementation::GetCurrentThread();
+
+		// The owner increments the biased count until it has been merged
+		if (referenceCount->owner == currentThread && !referenceCount->isMerged)
+		{
+			++referenceCount->biasedCount;
+
+			ProcessPendingMerges(currentThread);
+		}
+		// Every other thread increments the shared count
+		else
+		{
+			referenceCount->sharedCount.fetch_add(BiasedReferenceCount::one, std::memory_order_relaxed);
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Releases the reference held by this instance, if any, and destroys the object if it was the final reference
+	* This instance no longer holds a reference once this returns
+	*/
+	inline Status ReleaseReference()
+	{
+		// Check if this instance is holding a reference to an object
+		bool isHoldingReference;
+		IsHoldingReference(isHoldingReference);
+
+		if (!isHoldingReference)
+		{
+			return Status::SUCCESS;
+		}
+
+		BiasedReferenceCount* releasedCount = this->referenceCount;
+
+		// We no longer hold a reference, regardless of whether the object is destroyed
+		this->referenceCount = nullptr;
+		this->value = nullptr;
+
+		BiasedOwnerThread* currentThread = BiasedSharedImplementation::GetCurrentThread();
+
+		// The owner decrements the biased count until it has been merged
+		if (releasedCount->owner == currentThread && !releasedCount->isMerged)
+		{
+			releasedCount->biasedCount -= 1;
+
+			if (releasedCount->biasedCount == 0)
+			{
+				// The owner has no biased references left, so merge with the shared count
+				releasedCount->isMerged = true;
+
+				const i64 previous = releasedCount->sharedCount.fetch_add(
+					BiasedReferenceCount::merged,
+					std::memory_order_acq_rel
+				);
+
+				// If the object has been queued, the queue is responsible for destroying it
+				if ((previous & BiasedReferenceCount::queued) == 0 && (previous >> 2) == 0)
+				{
+					releasedCount->destroy(releasedCount);
+				}
+			}
+
+			ProcessPendingMerges(currentThread);
+
+			return Status::SUCCESS;
+		}
+
+		// Every other thread decrements the shared count
+		// A compare-exchange is used so that the queued flag is set in the same operation as the decrement when it makes
+		// the count negative; otherwise the owner could merge and destroy the object before we get to queue it
+		i64 expected = releasedCount->sharedCount.load(std::memory_order_relaxed);
+		i64 desired;
+
+		do
+		{
+			desired = expected - BiasedReferenceCount::one;
+
+			const bool isMerged = (desired & BiasedReferenceCount::merged) != 0;
+			const bool isQueued = (desired & BiasedReferenceCount::queued) != 0;
+
+			if (!isMerged && !isQueued && (desired >> 2) < 0)
+			{
+				desired |= BiasedReferenceCount::queued;
+			}
+		} while (!releasedCount->sharedCount.compare_exchange_weak(
+			expected,
+			desired,
+			std::memory_order_acq_rel,
+			std::memory_order_relaxed
+		));
+
+		// If we set the queued flag, hand the object to the owner to merge
+		if ((desired & BiasedReferenceCount::queued) != 0 && (expected & BiasedReferenceCount::queued) == 0)
+		{
+			Status status = BiasedSharedImplementation::Enqueue(releasedCount);
+			SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not queue biased reference count to its owner")
+			{
+				return Status::FAIL;
+			}
+		}
+		// Otherwise, if this was the final reference after merging, destroy the object
+		else if (
+			(desired & BiasedReferenceCount::merged) != 0 &&
+			(desired & BiasedReferenceCount::queued) == 0 &&
+			(desired >> 2) == 0
+		)
+		{
+			releasedCount->destroy(releasedCount);
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Processes the owner's merge queue if another thread has queued anything to it
+	* This is a single relaxed load when the queue is empty
+	*/
+	static inline void ProcessPendingMerges(BiasedOwnerThread* _thread)
+	{
+		if (_thread->queue.load(std::memory_order_relaxed) != nullptr)
+		{
+			Status status = BiasedSharedImplementation::ProcessQueue(_thread);
+			SLR_ERROR(status == Status::SUCCESS, "Could not process biased reference count merge queue");
+		}
+	}
+
+	/**
+	* Destroys the object held with _referenceCount and frees the allocation
+	*/
+	static void Destroy(BiasedReferenceCount* _referenceCount)
+	{
+		// Get the start of the allocation from the reference count
+		_Type* object = reinterpret_cast<_Type*>((size)_referenceCount - referenceCountOffset);
+
+		// Release the owner's record now that this object no longer refers to it
+		Status releaseStatus = BiasedSharedImplementation::ReleaseThread(_referenceCount->owner);
+		SLR_ERROR(releaseStatus == Status::SUCCESS, "Could not release owner thread of biased shared pointer");
+
+		// Call the destructors manually because we are not using new and delete
+		_referenceCount->~BiasedReferenceCount();
+		object->~_Type();
+
+		// Free the object and reference count, which were allocated together
+		Status freeStatus = MemFree<_Type>(object);
+		SLR_ERROR(freeStatus == Status::SUCCESS, "Could not free object held by biased shared pointer");
+	}
+};
+
+/**
+* Takes a reference to a biased shared pointer and constructs a dynamically allocated object within it such that the pointer
+* is now holding a reference to that object. The calling thread becomes the owner of the object.
+* Refer to CreateShared(...) for an explanation of the parameters.
+*/
+template<typename _Type, typename ... _Arguments>
+Status CreateBiasedShared(BiasedShared<_Type>& _shared, _Arguments&& ... _arguments)
+{
+	// Get the record for this thread as it will be the owner
+	BiasedOwnerThread* owner = nullptr;
+	Status ownerStatus = BiasedSharedImplementation::AcquireCurrentThread(owner);
+	SLR_ASSERT_ERROR(ownerStatus == Status::SUCCESS, "Could not get owner thread for biased shared pointer")
+	{
+		return Status::FAIL;
+	}
+
+	// Allocate the object and reference count together so we don't have to do multiple allocations
+	void* allocation = nullptr;
+	Status status = MemAlloc(allocation, BiasedShared<_Type>::referenceCountOffset + sizeof(BiasedReferenceCount));
+	SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not allocate memory for biased shared pointer object")
+	{
+		BiasedSharedImplementation::ReleaseThread(owner);
+
+		return Status::FAIL;
+	}
+
+	// Release any reference already held so it isn't leaked
+	_shared.ReleaseReference();
+
+	// [ value ][ padding ][ reference count ]
+	// ^
+	// allocation
+	_shared.value = reinterpret_cast<_Type*>(allocation);
+
+	// [ value ][ padding ][ reference count ]
+	//                     ^
+	//                     allocation + referenceCountOffset
+	_shared.referenceCount = new(reinterpret_cast<void*>((size)allocation + BiasedShared<_Type>::referenceCountOffset))
+		BiasedReferenceCount();
+
+	// This is the first reference, and it belongs to the owner
+	_shared.referenceCount->owner = owner;
+	_shared.referenceCount->biasedCount = 1;
+	_shared.referenceCount->destroy = &BiasedShared<_Type>::Destroy;
+
+	// Construct the object in-place of where _shared.value points to
+	new(_shared.value) _Type(std::forward<_Arguments>(_arguments)...);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Merges every object which other threads have queued to the calling thread
+* Owners process their queue automatically whenever they copy or release a BiasedShared, so this only needs to be called by
+* threads which create objects, hand them to other threads, and then stop using BiasedShared for a long time
+*/
+inline Status ProcessBiasedMerges()
+{
+	BiasedOwnerThread* currentThread = BiasedSharedImplementation::GetCurrentThread();
+
+	// This thread has never created an object, so nothing can have been queued to it
+	if (currentThread == nullptr)
+	{
+		return Status::SUCCESS;
+	}
+
+	return BiasedSharedImplementation::ProcessQueue(currentThread);
+}
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MEMORY_BIASEDSHAREDPOINTER
\ No newline at end of file
@@ -0,0 +1,147 @@
+#pragma once
+#ifndef SLR_MEMORY_COPYONWRITE
+#define SLR_MEMORY_COPYONWRITE
+
+#include <type_traits>
+#include <utility>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Memory/BiasedSharedPointer.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* A copy-on-write value
+* Copying a Cow shares the object held by it rather than copying the object. Reading the object never copies it, but writing
+* to it through Write(...) first clones the object if any other Cow is sharing it, so writes are never seen by other copies.
+* The object is held by a BiasedShared, therefore, copies can be passed to, and released on, other threads. Only Write(...)
+* may modify the object; the object itself is not synchronized, so a copy must not be written to by one thread while it is
+* being read by another.
+*/
+template<typename _Type>
+class Cow
+{
+	static_assert(std::is_copy_constructible<_Type>::value, "Copy-on-write type must be copy constructible");
+
+	template<typename _Other, typename ... _Arguments>
+	friend Status CreateCow(Cow<_Other>&, _Arguments&& ...);
+
+public:
+	/**
+	* Default constructor
+	* The Cow does not hold an object until it's assigned, or created with CreateCow(...)
+	*/
+	Cow() = default;
+
+	/**
+	* Returns whether this instance is holding an object
+	*/
+	inline Status IsHoldingValue(SLR_RETURN(bool) _isHoldingValue) const
+	{
+		return shared.IsHoldingReference(_isHoldingValue);
+	}
+
+	/**
+	* Returns a const pointer to the object for reading
+	* This never copies the object
+	*/
+	inline Status Read(SLR_RETURN(const _Type*) _value) const
+	{
+		// Check if we're holding an object
+		bool isHoldingValue;
+		IsHoldingValue(isHoldingValue);
+		SLR_ASSERT_ERROR(isHoldingValue == true, "Not holding an object to read")
+		{
+			return Status::FAIL;
+		}
+
+		_value = &*shared;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a pointer to the object for writing
+	* If the object is shared with any other Cow, it's cloned first so this instance holds the only reference to it
+	* The pointer is valid until this instance is copied, assigned, or destroyed
+	*/
+	Status Write(SLR_RETURN(_Type*) _value)
+	{
+		// Check if we're holding an object
+		bool isHoldingValue;
+		IsHoldingValue(isHoldingValue);
+		SLR_ASSERT_ERROR(isHoldingValue == true, "Not holding an object to write")
+		{
+			return Status::FAIL;
+		}
+
+		bool isUnique;
+		Status uniqueStatus = shared.IsUnique(isUnique);
+		SLR_ASSERT_ERROR(uniqueStatus == Status::SUCCESS, "Could not check whether the object is shared")
+		{
+			return Status::FAIL;
+		}
+
+		// Clone the object so that writes aren't seen by the other references
+		if (!isUnique)
+		{
+			BiasedShared<_Type> clone;
+			Status cloneStatus = CreateBiasedShared(clone, static_cast<const _Type&>(*shared));
+			SLR_ASSERT_ERROR(cloneStatus == Status::SUCCESS, "Could not clone shared object")
+			{
+				return Status::FAIL;
+			}
+
+			// Release our reference to the shared object and take the clone
+			shared = std::move(clone);
+		}
+
+		_value = &*shared;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns a const reference to the object
+	*/
+	const _Type& operator*() const
+	{
+		return *shared;
+	}
+
+	/**
+	* Returns a const pointer to the object
+	*/
+	const _Type* operator->() const
+	{
+		return &*shared;
+	}
+
+private:
+	/**
+	* The shared object
+	*/
+	BiasedShared<_Type> shared;
+};
+
+/**
+* Takes a reference to a Cow and constructs a dynamically allocated object within it, forwarding _arguments to the constructor
+* of _Type. Any object previously held by _cow is released.
+*/
+template<typename _Type, typename ... _Arguments>
+Status CreateCow(Cow<_Type>& _cow, _Arguments&& ... _arguments)
+{
+	Status status = CreateBiasedShared(_cow.shared, std::forward<_Arguments>(_arguments)...);
+	SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not create copy-on-write object")
+	{
+		return Status::FAIL;
+	}
+
+	return Status::SUCCESS;
+}
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MEMORY_COPYONWRITE
\ No newline at end of file
@@ -0,0 +1,259 @@
+#pragma once
+#ifndef SLR_MEMORY_EPOCHRECLAMATION
+#define SLR_MEMORY_EPOCHRECLAMATION
+
+#include <atomic>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Memory/Reclamation.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+class EpochDomain;
+
+/**
+* A thread which has been registered with an EpochDomain
+* Every member function must only be called by the thread which registered it
+* A thread must be pinned while it reads nodes of a lock-free structure; any node which was unlinked from the structure and
+* retired while the thread was pinned will not be reclaimed until the thread unpins
+*/
+class EpochThread
+{
+	friend class EpochDomain;
+
+public:
+	/**
+	* Pins the thread to the current epoch
+	* Pins may be nested, in which case the thread is unpinned once every pin has been matched with a call to Unpin()
+	*/
+	Status Pin();
+
+	/**
+	* Unpins the thread, allowing nodes retired while it was pinned to be reclaimed
+	*/
+	Status Unpin();
+
+	/**
+	* Retires a node which has been unlinked from a lock-free structure
+	* _deleter is called once no pinned thread can still be reading the node
+	* Retiring a node may reclaim a batch of previously retired nodes. If the thread already holds the maximum number of
+	* unreclaimed nodes and none of them can be reclaimed, FAIL is returned and the caller retains ownership of _node.
+	*/
+	Status RetireNode(void* _node, RetireDeleter _deleter);
+
+	/**
+	* Retires a node which was allocated with MemAlloc(...)
+	* Once it is safe to do so, the destructor of _Type is called and the node is freed with MemFree(...)
+	*/
+	template<typename _Type>
+	Status RetireNode(_Type* _node)
+	{
+		return RetireNode(static_cast<void*>(_node), &MemFreeNode<_Type>);
+	}
+
+	/**
+	* Attempts to advance the epoch, then reclaims every node retired by this thread which can no longer be read
+	*/
+	Status Reclaim();
+
+	/**
+	* Returns the number of nodes retired by this thread which have not yet been reclaimed
+	*/
+	inline Status GetRetiredCount(SLR_RETURN(size) _retiredCount) const
+	{
+		_retiredCount = this->retiredCount;
+
+		return Status::SUCCESS;
+	}
+
+private:
+	/**
+	* A retired node, along with the epoch it was retired in
+	*/
+	struct EpochRetiredNode
+	{
+		RetiredNode retired;
+		u64 epoch;
+	};
+
+	/**
+	* The bit within `state` which is set while the thread is pinned
+	* The rest of `state` holds the epoch the thread is pinned to, shifted left by one
+	*/
+	static constexpr u64 pinnedBit = 1;
+
+	/**
+	* The domain the thread is registered with
+	*/
+	EpochDomain* domain = nullptr;
+
+	/**
+	* The epoch the thread is pinned to, along with `pinnedBit`
+	* This is read by other threads when advancing the epoch
+	*/
+	std::atomic<u64> state = 0;
+
+	/**
+	* Whether a thread is currently registered with this record
+	* Records are never freed while the domain exists; they are reused when a new thread registers
+	*/
+	std::atomic<bool> isInUse = false;
+
+	/**
+	* The next record within the domain
+	*/
+	EpochThread* next = nullptr;
+
+	/**
+	* The number of times the thread has been pinned without being unpinned
+	*/
+	size pinDepth = 0;
+
+	/**
+	* The nodes retired by this thread which have not yet been reclaimed
+	* This is allocated once, with a capacity of the domain's retired limit, so that retiring never reallocates
+	*/
+	EpochRetiredNode* retired = nullptr;
+
+	/**
+	* The number of nodes within `retired`
+	*/
+	size retiredCount = 0;
+
+	/**
+	* Constructor
+	* Records can only be created by a domain
+	*/
+	EpochThread() = default;
+
+	/**
+	* Reclaims every retired node which was retired at least two epochs before _epoch
+	*/
+	Status ReclaimBefore(const u64 _epoch);
+};
+
+/**
+* An epoch-based memory reclamation domain
+* Threads register with the domain, then pin themselves while they read from a lock-free structure. A node unlinked from the
+* structure is retired rather than freed, and is reclaimed once the global epoch has advanced twice since it was retired;
+* the epoch only advances when every pinned thread has observed the current epoch, so by then no thread can still be reading
+* the node. Nodes are reclaimed in batches by the thread which retired them.
+* A thread which stays pinned prevents the epoch from advancing, therefore, each thread may only hold a limited number of
+* unreclaimed nodes; refer to EpochThread::RetireNode(...).
+*/
+class EpochDomain
+{
+	friend class EpochThread;
+
+public:
+	/**
+	* Constructor
+	* _reclaimThreshold is the number of unreclaimed nodes a thread may hold before retiring a node reclaims a batch
+	* _retiredLimit is the maximum number of unreclaimed nodes a thread may hold
+	*/
+	EpochDomain(const size _reclaimThreshold = 64, const size _retiredLimit = 4096);
+
+	/**
+	* Destructor
+	* Every thread must have been unregistered; any nodes which have not yet been reclaimed are reclaimed immediately
+	*/
+	~EpochDomain();
+
+	/**
+	* Registers the calling thread with the domain
+	* _thread must only be used by the calling thread, and must be unregistered before the thread exits
+	*/
+	Status RegisterThread(SLR_RETURN(EpochThread*) _thread);
+
+	/**
+	* Unregisters a thread from the domain
+	* The thread must not be pinned. Nodes retired by the thread which cannot yet be reclaimed are kept and reclaimed by the
+	* next thread to be registered, or when the domain is destroyed.
+	* _thread is set to nullptr
+	*/
+	Status UnregisterThread(SLR_RETURN(EpochThread*) _thread);
+
+	/**
+	* Returns the current global epoch
+	*/
+	inline Status GetEpoch(SLR_RETURN(u64) _epoch) const
+	{
+		_epoch = this->epoch.load(std::memory_order_acquire);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Advances the global epoch if every pinned thread has observed the current epoch
+	* _didAdvance is set to whether the epoch was advanced by this call
+	*/
+	Status TryAdvance(SLR_RETURN(bool) _didAdvance);
+
+private:
+	/**
+	* The global epoch
+	*/
+	std::atomic<u64> epoch = 0;
+
+	/**
+	* The list of every record ever registered with the domain
+	*/
+	std::atomic<EpochThread*> threads = nullptr;
+
+	/**
+	* The number of unreclaimed nodes a thread may hold before retiring a node reclaims a batch
+	*/
+	const size reclaimThreshold;
+
+	/**
+	* The maximum number of unreclaimed nodes a thread may hold
+	*/
+	const size retiredLimit;
+};
+
+/**
+* Pins an EpochThread for the lifetime of the guard
+* Example usage:
+*     {
+*         EpochGuard guard(*thread);
+*         // Read from the lock-free structure
+*     }
+*/
+class EpochGuard
+{
+public:
+	/**
+	* Constructor
+	* Pins _thread
+	*/
+	EpochGuard(EpochThread& _thread) : thread(_thread)
+	{
+		Status status = thread.Pin();
+		SLR_ERROR(status == Status::SUCCESS, "Could not pin epoch thread");
+	}
+
+	/**
+	* Destructor
+	* Unpins the thread
+	*/
+	~EpochGuard()
+	{
+		Status status = thread.Unpin();
+		SLR_ERROR(status == Status::SUCCESS, "Could not unpin epoch thread");
+	}
+
+	EpochGuard(const EpochGuard&) = delete;
+	EpochGuard& operator=(const EpochGuard&) = delete;
+
+private:
+	/**
+	* The thread which is pinned
+	*/
+	EpochThread& thread;
+};
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MEMORY_EPOCHRECLAMATION
\ No newline at end of file
@@ -0,0 +1,295 @@
+#pragma once
+#ifndef SLR_MEMORY_HAZARDPOINTERS
+#define SLR_MEMORY_HAZARDPOINTERS
+
+#include <atomic>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Memory/Reclamation.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+class HazardDomain;
+
+/**
+* A thread which has been registered with a HazardDomain
+* Every member function must only be called by the thread which registered it
+* Before dereferencing a node of a lock-free structure, the thread protects it within one of its hazard slots; a retired node
+* is never reclaimed while it is held within any thread's hazard slot
+*/
+class HazardThread
+{
+	friend class HazardDomain;
+
+public:
+	/**
+	* The number of hazard slots each thread has
+	* This is the maximum number of nodes a thread may protect at once
+	*/
+	static constexpr size slotCount = 4;
+
+	/**
+	* Loads a pointer from _source and protects it within hazard slot _slot
+	* The load is repeated until the pointer within _source is unchanged after being published to the slot, therefore, if the
+	* returned pointer is not nullptr, it's safe to dereference until the slot is reset or reused
+	*/
+	template<typename _Type>
+	Status Protect(SLR_RETURN(_Type*) _protected, const std::atomic<_Type*>& _source, const size _slot)
+	{
+		SLR_ASSERT_ERROR(_slot < slotCount, "Invalid hazard slot provided")
+		{
+			return Status::FAIL;
+		}
+
+		_Type* pointer = _source.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			// Publish the hazard before validating it; this must be ordered before the load below
+			slots[_slot].store(static_cast<void*>(pointer), std::memory_order_seq_cst);
+
+			_Type* current = _source.load(std::memory_order_acquire);
+
+			// If the source still holds the pointer, it cannot have been retired before it was published
+			if (current == pointer)
+			{
+				break;
+			}
+
+			pointer = current;
+		}
+
+		_protected = pointer;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Clears hazard slot _slot, allowing the node it protected to be reclaimed
+	*/
+	inline Status Reset(const size _slot)
+	{
+		SLR_ASSERT_ERROR(_slot < slotCount, "Invalid hazard slot provided")
+		{
+			return Status::FAIL;
+		}
+
+		slots[_slot].store(nullptr, std::memory_order_release);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Clears every hazard slot
+	*/
+	inline Status ResetAll()
+	{
+		for (size slot = 0; slot < slotCount; ++slot)
+		{
+			slots[slot].store(nullptr, std::memory_order_release);
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Retires a node which has been unlinked from a lock-free structure
+	* _deleter is called once no hazard slot holds the node
+	* Once the thread holds more retired nodes than the domain's scan threshold plus the total number of hazard slots, a scan
+	* reclaims every retired node which is not protected, therefore, the number of unreclaimed nodes held by a thread is
+	* bounded regardless of whether other threads have stalled.
+	* Fails only if the node could not be recorded, in which case it was not retired and remains owned by the caller.
+	*/
+	Status RetireNode(void* _node, RetireDeleter _deleter);
+
+	/**
+	* Retires a node which was allocated with MemAlloc(...)
+	* Once it is safe to do so, the destructor of _Type is called and the node is freed with MemFree(...)
+	*/
+	template<typename _Type>
+	Status RetireNode(_Type* _node)
+	{
+		return RetireNode(static_cast<void*>(_node), &MemFreeNode<_Type>);
+	}
+
+	/**
+	* Reclaims every node retired by this thread which is not held within a hazard slot
+	*/
+	Status Scan();
+
+	/**
+	* Returns the number of nodes retired by this thread which have not yet been reclaimed
+	*/
+	inline Status GetRetiredCount(SLR_RETURN(size) _retiredCount) const
+	{
+		_retiredCount = this->retiredCount;
+
+		return Status::SUCCESS;
+	}
+
+private:
+	/**
+	* The domain the thread is registered with
+	*/
+	HazardDomain* domain = nullptr;
+
+	/**
+	* The hazard slots of the thread
+	* These are read by every thread which scans
+	*/
+	std::atomic<void*> slots[slotCount] = {};
+
+	/**
+	* Whether a thread is currently registered with this record
+	* Records are never freed while the domain exists; they are reused when a new thread registers
+	*/
+	std::atomic<bool> isInUse = false;
+
+	/**
+	* The next record within the domain
+	*/
+	HazardThread* next = nullptr;
+
+	/**
+	* The nodes retired by this thread which have not yet been reclaimed
+	*/
+	RetiredNode* retired = nullptr;
+
+	/**
+	* The number of nodes within `retired`
+	*/
+	size retiredCount = 0;
+
+	/**
+	* The number of nodes `retired` has been allocated to hold
+	*/
+	size retiredCapacity = 0;
+
+	/**
+	* A sorted snapshot of every hazard slot, taken while scanning
+	* This is kept between scans so that scanning doesn't allocate once it's large enough
+	*/
+	void** hazards = nullptr;
+
+	/**
+	* The number of pointers `hazards` has been allocated to hold
+	*/
+	size hazardsCapacity = 0;
+
+	/**
+	* Constructor
+	* Records can only be created by a domain
+	*/
+	HazardThread() = default;
+
+	/**
+	* Reclaims every retired node without checking the hazard slots
+	* This must only be called once no thread can be reading any node
+	*/
+	Status ReclaimAll();
+};
+
+/**
+* A hazard pointer memory reclamation domain
+* Threads register with the domain, then protect each node of a lock-free structure within a hazard slot before reading it. A
+* node unlinked from the structure is retired rather than freed; retired nodes are reclaimed in batches by the thread which
+* retired them, by scanning the hazard slots of every thread and reclaiming each node which is not protected.
+* Unlike EpochDomain, a stalled reader only prevents the nodes it protects from being reclaimed, so the amount of unreclaimed
+* memory remains bounded.
+*/
+class HazardDomain
+{
+	friend class HazardThread;
+
+public:
+	/**
+	* Constructor
+	* _scanThreshold is the number of retired nodes, above the total number of hazard slots, a thread may hold before
+	* retiring a node scans the hazard slots
+	*/
+	HazardDomain(const size _scanThreshold = 64);
+
+	/**
+	* Destructor
+	* Every thread must have been unregistered; any nodes which have not yet been reclaimed are reclaimed immediately
+	*/
+	~HazardDomain();
+
+	/**
+	* Registers the calling thread with the domain
+	* _thread must only be used by the calling thread, and must be unregistered before the thread exits
+	*/
+	Status RegisterThread(SLR_RETURN(HazardThread*) _thread);
+
+	/**
+	* Unregisters a thread from the domain
+	* The thread's hazard slots are reset. Nodes retired by the thread which are still protected are kept and reclaimed by the
+	* next thread to be registered, or when the domain is destroyed.
+	* _thread is set to nullptr
+	*/
+	Status UnregisterThread(SLR_RETURN(HazardThread*) _thread);
+
+private:
+	/**
+	* The list of every record ever registered with the domain
+	*/
+	std::atomic<HazardThread*> threads = nullptr;
+
+	/**
+	* The number of records within `threads`
+	*/
+	std::atomic<size> threadCount = 0;
+
+	/**
+	* The number of retired nodes, above the total number of hazard slots, a thread may hold before scanning
+	*/
+	const size scanThreshold;
+};
+
+/**
+* Resets a hazard slot when the guard is destroyed
+* Example usage:
+*     Node* node;
+*     HazardGuard guard(*thread, 0);
+*     thread->Protect(node, head, 0);
+*     // Read from node
+*/
+class HazardGuard
+{
+public:
+	/**
+	* Constructor
+	* Takes the thread and the slot which is reset by the destructor
+	*/
+	HazardGuard(HazardThread& _thread, const size _slot) : thread(_thread), slot(_slot) {}
+
+	/**
+	* Destructor
+	* Resets the slot
+	*/
+	~HazardGuard()
+	{
+		Status status = thread.Reset(slot);
+		SLR_ERROR(status == Status::SUCCESS, "Could not reset hazard slot");
+	}
+
+	HazardGuard(const HazardGuard&) = delete;
+	HazardGuard& operator=(const HazardGuard&) = delete;
+
+private:
+	/**
+	* The thread owning the slot
+	*/
+	HazardThread& thread;
+
+	/**
+	* The slot which is reset
+	*/
+	const size slot;
+};
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MEMORY_HAZARDPOINTERS
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+#ifndef SLR_MEMORY_RECLAMATION
+#define SLR_MEMORY_RECLAMATION
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Memory/Allocation.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* A function which destroys and frees a node once it is safe to do so
+* Nodes are passed as void pointers so that nodes of different types can be retired to the same list
+*/
+using RetireDeleter = void (*)(void*);
+
+/**
+* A node which has been unlinked from a lock-free structure but may still be being read by other threads
+*/
+struct RetiredNode
+{
+	/**
+	* The node to be reclaimed
+	*/
+	void* node;
+
+	/**
+	* The function which destroys and frees the node
+	*/
+	RetireDeleter deleter;
+};
+
+/**
+* The default deleter for retired nodes
+* Calls the destructor of _Type then frees the node with MemFree(...), therefore, the node must have been allocated with
+* MemAlloc(...) or MemRealloc(...)
+*/
+template<typename _Type>
+void MemFreeNode(void* _node)
+{
+	_Type* node = static_cast<_Type*>(_node);
+
+	// Call the destructor manually because we are not using new and delete
+	node->~_Type();
+
+	Status status = MemFree<_Type>(node);
+	SLR_ERROR(status == Status::SUCCESS, "Could not free retired node");
+}
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_MEMORY_RECLAMATION
\ No newline at end of file
@@ -0,0 +1,511 @@
+#pragma once
+#ifndef SLR_SPATIAL_KDTREE2
+#define SLR_SPATIAL_KDTREE2
+
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+
+#include "SlrLib/Containers/DynamicArray.hpp"
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Math/Vector2.hpp"
+#include "SlrLib/Memory/Allocation.hpp"
+#include "SlrLib/Spatial/Neighbor.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* A static k-d tree over Vector2 points, used for nearest-neighbor queries against a set of points which rarely changes
+* The tree is implicit: the points are reordered within a single array so that the node of the range [first, last) is the
+* point at the middle of the range, with the points of its left subtree before it and those of its right subtree after
+* it. Nodes at even depths split on x and nodes at odd depths split on y. No child pointers are stored, and ranges of a few
+* points are left unordered as leaves which are scanned as a whole.
+* Each point is identified by its index within the array the tree was built from.
+* Queries do not modify the tree, so any number of threads may query it at once.
+*/
+template<typename _Type>
+class KdTree2
+{
+	static_assert(std::is_floating_point<_Type>::value, "Type of k-d tree template must be floating point");
+
+public:
+	/**
+	* Default constructor
+	* The tree contains no points until Build(...) is called
+	*/
+	KdTree2() = default;
+
+	KdTree2(const KdTree2&) = delete;
+	KdTree2& operator=(const KdTree2&) = delete;
+
+	/**
+	* Destructor
+	* Frees the points of the tree
+	*/
+	~KdTree2()
+	{
+		if (nodes != nullptr)
+		{
+			Status freeStatus = MemFree<Node>(nodes);
+			SLR_ERROR(freeStatus == Status::SUCCESS, "Could not free the points of the tree");
+		}
+	}
+
+	/**
+	* Replaces the contents of the tree with _points
+	* This takes O(n log n) time on average; the buffer is kept between builds
+	*/
+	Status Build(const std::span<const Vector2<_Type>> _points)
+	{
+		SLR_ASSERT_ERROR(_points.size() < std::numeric_limits<u32>::max(), "Too many points for the tree to identify")
+		{
+			return Status::FAIL;
+		}
+
+		// MemAlloc(...) cannot allocate 0 bytes, so always reserve room for at least one point
+		Status reserveStatus = MemReserve<Node>(nodes, std::max<size>(_points.size(), 1) * sizeof(Node));
+		SLR_ASSERT_ERROR(reserveStatus == Status::SUCCESS, "Could not allocate the points of the tree")
+		{
+			this->pointCount = 0;
+
+			return Status::FAIL;
+		}
+
+		this->pointCount = static_cast<u32>(_points.size());
+
+		for (u32 i = 0; i < pointCount; ++i)
+		{
+			nodes[i] = Node{ _points[i].x, _points[i].y, i };
+		}
+
+		Partition(0, pointCount, 0);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Replaces the contents of the tree with the elements of _points
+	*/
+	Status Build(const DynamicArray<Vector2<_Type>>& _points)
+	{
+		std::span<const Vector2<_Type>> points;
+		_points.GetSpan(points);
+
+		return Build(points);
+	}
+
+	/**
+	* Finds the point nearest to _point
+	* Equally distant points are resolved to the lowest ID. Fails if the tree holds no points.
+	*/
+	Status Nearest(SLR_RETURN(Neighbor<_Type>) _nearest, const Vector2<_Type>& _point) const
+	{
+		SLR_ASSERT_ERROR(pointCount > 0, "Cannot find the nearest point of an empty tree")
+		{
+			return Status::FAIL;
+		}
+
+		size count;
+		KNearest(count, std::span<Neighbor<_Type>>(&_nearest, 1), _point);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Finds the points nearest to _point, up to the size of _neighbors
+	* _neighbors is filled from nearest to furthest, and _count is set to the number of neighbors found, which is only less
+	* than the size of _neighbors if the tree holds fewer points. Equally distant points are ordered by ID.
+	*/
+	Status KNearest(SLR_RETURN(size) _count, const std::span<Neighbor<_Type>> _neighbors, const Vector2<_Type>& _point) const
+	{
+		_count = 0;
+
+		if (pointCount == 0 || _neighbors.empty())
+		{
+			return Status::SUCCESS;
+		}
+
+		SearchEntry stack[maximumStackSize];
+		size stackSize = 0;
+
+		stack[stackSize++] = SearchEntry{ 0, pointCount, 0, 0 };
+
+		while (stackSize > 0)
+		{
+			const SearchEntry entry = stack[--stackSize];
+
+			// Subtrees which are further than the furthest neighbor found so far cannot contain a closer point
+			if (entry.distanceSquared > NeighborImplementation::GetBound(_neighbors, _count))
+			{
+				continue;
+			}
+
+			if (entry.last - entry.first <= leafSize)
+			{
+				for (u32 i = entry.first; i < entry.last; ++i)
+				{
+					const _Type x = nodes[i].x - _point.x;
+					const _Type y = nodes[i].y - _point.y;
+
+					NeighborImplementation::Offer(_neighbors, _count, Neighbor<_Type>{ nodes[i].id, (x * x) + (y * y) });
+				}
+
+				continue;
+			}
+
+			const u32 middle = entry.first + ((entry.last - entry.first) / 2);
+			const Node& node = nodes[middle];
+
+			const _Type x = node.x - _point.x;
+			const _Type y = node.y - _point.y;
+
+			NeighborImplementation::Offer(_neighbors, _count, Neighbor<_Type>{ node.id, (x * x) + (y * y) });
+
+			PushChildren(stack, stackSize, entry, middle, (entry.depth & 1) ? -y : -x);
+		}
+
+		NeighborImplementation::Finish(_neighbors, _count);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Calls _callback(id) for every point within _radius of _center, including points on the boundary
+	*/
+	template<typename _Callback>
+	Status QueryRadius(const Vector2<_Type>& _center, const _Type _radius, _Callback&& _callback) const
+	{
+		SLR_ASSERT_ERROR(_radius >= 0, "Radius must not be negative")
+		{
+			return Status::FAIL;
+		}
+
+		if (pointCount == 0)
+		{
+			return Status::SUCCESS;
+		}
+
+		const _Type radiusSquared = _radius * _radius;
+
+		SearchEntry stack[maximumStackSize];
+		size stackSize = 0;
+
+		stack[stackSize++] = SearchEntry{ 0, pointCount, 0, 0 };
+
+		while (stackSize > 0)
+		{
+			const SearchEntry entry = stack[--stackSize];
+
+			if (entry.distanceSquared > radiusSquared)
+			{
+				continue;
+			}
+
+			if (entry.last - entry.first <= leafSize)
+			{
+				for (u32 i = entry.first; i < entry.last; ++i)
+				{
+					const _Type x = nodes[i].x - _center.x;
+					const _Type y = nodes[i].y - _center.y;
+
+					if ((x * x) + (y * y) <= radiusSquared)
+					{
+						_callback(nodes[i].id);
+					}
+				}
+
+				continue;
+			}
+
+			const u32 middle = entry.first + ((entry.last - entry.first) / 2);
+			const Node& node = nodes[middle];
+
+			const _Type x = node.x - _center.x;
+			const _Type y = node.y - _center.y;
+
+			if ((x * x) + (y * y) <= radiusSquared)
+			{
+				_callback(node.id);
+			}
+
+			PushChildren(stack, stackSize, entry, middle, (entry.depth & 1) ? -y : -x);
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Finds the nearest point to each of _points, writing it to the same index of _nearest
+	* The queries are divided between _threadCount threads, including the calling thread; a thread count of 0 uses the
+	* number of hardware threads. Fails if the tree holds no points, or if the threads cannot be started, in which case only
+	* some of the queries may have been answered.
+	*/
+	Status BatchNearest(
+		const std::span<Neighbor<_Type>> _nearest,
+		const std::span<const Vector2<_Type>> _points,
+		const size _threadCount = 0
+	) const
+	{
+		SLR_ASSERT_ERROR(_nearest.size() == _points.size(), "Batch arrays must be the same size")
+		{
+			return Status::FAIL;
+		}
+
+		SLR_ASSERT_ERROR(pointCount > 0, "Cannot find the nearest point of an empty tree")
+		{
+			return Status::FAIL;
+		}
+
+		const Status status = ParallelFor(_points.size(), _threadCount, [&](const size _first, const size _last)
+		{
+			for (size i = _first; i < _last; ++i)
+			{
+				size count;
+				KNearest(count, _nearest.subspan(i, 1), _points[i]);
+			}
+		});
+		SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not divide the queries between threads")
+		{
+			return Status::FAIL;
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Finds the _k nearest points to each of _points
+	* The neighbors of query i are written to _neighbors[i * _k] onwards, from nearest to furthest, and their number to
+	* _counts[i]. The queries are divided between _threadCount threads, including the calling thread; a thread count of 0
+	* uses the number of hardware threads. Fails if the threads cannot be started, in which case only some of the queries may
+	* have been answered.
+	*/
+	Status BatchKNearest(
+		const std::span<size> _counts,
+		const std::span<Neighbor<_Type>> _neighbors,
+		const std::span<const Vector2<_Type>> _points,
+		const size _k,
+		const size _threadCount = 0
+	) const
+	{
+		SLR_ASSERT_ERROR(
+			_counts.size() == _points.size() && _neighbors.size() == _points.size() * _k,
+			"Batch arrays must hold one count and _k neighbors per point"
+		)
+		{
+			return Status::FAIL;
+		}
+
+		const Status status = ParallelFor(_points.size(), _threadCount, [&](const size _first, const size _last)
+		{
+			for (size i = _first; i < _last; ++i)
+			{
+				KNearest(_counts[i], _neighbors.subspan(i * _k, _k), _points[i]);
+			}
+		});
+		SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not divide the queries between threads")
+		{
+			return Status::FAIL;
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the number of points within the tree
+	*/
+	inline Status GetSize(SLR_RETURN(size) _size) const
+	{
+		_size = this->pointCount;
+
+		return Status::SUCCESS;
+	}
+
+private:
+	/**
+	* A point, along with its ID
+	*/
+	struct Node
+	{
+		_Type x;
+		_Type y;
+		u32 id;
+	};
+
+	/**
+	* A subtree waiting to be searched, along with the squared distance from the query point to the side of the splitting
+	* plane it lies on
+	*/
+	struct SearchEntry
+	{
+		u32 first;
+		u32 last;
+		u32 depth;
+		_Type distanceSquared;
+	};
+
+	/**
+	* The number of points at or below which a subtree is scanned as a whole rather than searched through its nodes
+	* The points of such a subtree are stored consecutively, so scanning them is cheaper than pruning
+	*/
+	static constexpr u32 leafSize = 8;
+
+	/**
+	* Each visited node pushes at most two subtrees, replacing itself, so the stack holds at most one entry per level of the
+	* tree plus one; a tree of 2^32 points has 33 levels
+	*/
+	static constexpr size maximumStackSize = 34;
+
+	/**
+	* The points of the tree in implicit order
+	*/
+	Node* nodes = nullptr;
+
+	/**
+	* The number of points within the tree
+	*/
+	u32 pointCount = 0;
+
+	/**
+	* Orders the points of [_first, _last) so that the middle point splits the rest on the axis of _depth, then orders both
+	* halves
+	*/
+	void Partition(u32 _first, const u32 _last, u32 _depth)
+	{
+		// Loop on the right half rather than recursing, so that recursion is only as deep as the tree
+		while (_last - _first > leafSize)
+		{
+			const u32 middle = _first + ((_last - _first) / 2);
+
+			if (_depth & 1)
+			{
+				std::nth_element(nodes + _first, nodes + middle, nodes + _last, [](const Node& _left, const Node& _right)
+				{
+					return _left.y < _right.y;
+				});
+			}
+			else
+			{
+				std::nth_element(nodes + _first, nodes + middle, nodes + _last, [](const Node& _left, const Node& _right)
+				{
+					return _left.x < _right.x;
+				});
+			}
+
+			Partition(_first, middle, _depth + 1);
+
+			_first = middle + 1;
+			++_depth;
+		}
+	}
+
+	/**
+	* Pushes the subtrees either side of _middle, the node of _entry
+	* _offset is the signed distance from the query point to the splitting plane; the subtree on the same side as the query
+	* point is pushed last so that it is searched first
+	*/
+	static inline void PushChildren(
+		SearchEntry* _stack,
+		size& _stackSize,
+		const SearchEntry& _entry,
+		const u32 _middle,
+		const _Type _offset
+	)
+	{
+		const SearchEntry left{ _entry.first, _middle, _entry.depth + 1, 0 };
+		const SearchEntry right{ _middle + 1, _entry.last, _entry.depth + 1, 0 };
+
+		// The near subtree is no further than the node itself, while the far subtree is at least as far as the plane
+		const SearchEntry& nearSubtree = _offset < 0 ? left : right;
+		const SearchEntry& farSubtree = _offset < 0 ? right : left;
+
+		if (farSubtree.first < farSubtree.last)
+		{
+			_stack[_stackSize++] = SearchEntry{
+				farSubtree.first, farSubtree.last, farSubtree.depth, std::max(_entry.distanceSquared, _offset * _offset)
+			};
+		}
+
+		if (nearSubtree.first < nearSubtree.last)
+		{
+			_stack[_stackSize++] = SearchEntry{ nearSubtree.first, nearSubtree.last, nearSubtree.depth, _entry.distanceSquared };
+		}
+	}
+
+	/**
+	* Calls _function(first, last) for _threadCount contiguous ranges which together cover [0, _count)
+	* The last range is processed by the calling thread. Fails if the threads cannot be started, in which case any threads
+	* which were started are joined and the calling thread's range is not processed.
+	*/
+	template<typename _Function>
+	static Status ParallelFor(const size _count, size _threadCount, _Function&& _function)
+	{
+		if (_threadCount == 0)
+		{
+			_threadCount = std::max<size>(std::thread::hardware_concurrency(), 1);
+		}
+
+		_threadCount = std::min(_threadCount, std::max<size>(_count, 1));
+
+		// Every slot is reserved up front, so a started thread can always be added and later joined
+		DynamicArray<std::thread> threads;
+		Status status = threads.SetCapacity(_threadCount - 1);
+		SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not allocate the worker threads")
+		{
+			return Status::FAIL;
+		}
+
+		for (size thread = 0; thread + 1 < _threadCount; ++thread)
+		{
+			std::thread worker;
+
+			// std::thread reports failing to start by throwing, which can't be allowed past the threads already started
+			try
+			{
+				worker = std::thread(_function, (_count * thread) / _threadCount, (_count * (thread + 1)) / _threadCount);
+			}
+			catch (const std::system_error&)
+			{
+				status = Status::FAIL;
+
+				break;
+			}
+
+			if (threads.Add(std::move(worker)) != Status::SUCCESS)
+			{
+				worker.join();
+				status = Status::FAIL;
+
+				break;
+			}
+		}
+
+		if (status == Status::SUCCESS)
+		{
+			_function((_count * (_threadCount - 1)) / _threadCount, _count);
+		}
+
+		std::span<std::thread> spawned;
+		threads.GetSpan(spawned);
+
+		for (std::thread& thread : spawned)
+		{
+			thread.join();
+		}
+
+		SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not start the worker threads")
+		{
+			return Status::FAIL;
+		}
+
+		return Status::SUCCESS;
+	}
+};
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_SPATIAL_KDTREE2
\ No newline at end of file
@@ -0,0 +1,98 @@
+#pragma once
+#ifndef SLR_SPATIAL_NEIGHBOR
+#define SLR_SPATIAL_NEIGHBOR
+
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* A point found by a nearest-neighbor query
+*/
+template<typename _Type>
+struct Neighbor
+{
+	static_assert(std::is_floating_point<_Type>::value, "Type of neighbor template must be floating point");
+
+	/**
+	* The ID of the point
+	*/
+	u32 id;
+
+	/**
+	* The squared distance from the query point to the point
+	*/
+	_Type distanceSquared;
+};
+
+/**
+* Shared implementation of the nearest-neighbor queries
+* This class is purely to hide the implementation from the user to make it clear not to interact with anything contained
+* within it
+*/
+class NeighborImplementation
+{
+public:
+	/**
+	* Orders neighbors by distance, then by ID so that equally distant neighbors are always found in the same order
+	*/
+	template<typename _Type>
+	static constexpr bool IsCloser(const Neighbor<_Type>& _left, const Neighbor<_Type>& _right)
+	{
+		return
+			_left.distanceSquared < _right.distanceSquared ||
+			(_left.distanceSquared == _right.distanceSquared && _left.id < _right.id);
+	}
+
+	/**
+	* Offers a candidate to the _count nearest neighbors found so far, which are stored as a max-heap within _neighbors
+	* Once the heap is full, the candidate replaces the furthest neighbor if it is closer
+	*/
+	template<typename _Type>
+	static inline void Offer(const std::span<Neighbor<_Type>> _neighbors, size& _count, const Neighbor<_Type>& _candidate)
+	{
+		if (_count < _neighbors.size())
+		{
+			_neighbors[_count] = _candidate;
+			++_count;
+
+			std::push_heap(_neighbors.begin(), _neighbors.begin() + _count, IsCloser<_Type>);
+		}
+		else if (IsCloser(_candidate, _neighbors[0]))
+		{
+			std::pop_heap(_neighbors.begin(), _neighbors.begin() + _count, IsCloser<_Type>);
+
+			_neighbors[_count - 1] = _candidate;
+
+			std::push_heap(_neighbors.begin(), _neighbors.begin() + _count, IsCloser<_Type>);
+		}
+	}
+
+	/**
+	* Returns the squared distance a candidate must be within to be offered, which is infinite until the heap is full
+	*/
+	template<typename _Type>
+	static inline _Type GetBound(const std::span<Neighbor<_Type>> _neighbors, const size _count)
+	{
+		return _count < _neighbors.size() ? std::numeric_limits<_Type>::infinity() : _neighbors[0].distanceSquared;
+	}
+
+	/**
+	* Sorts the heap of neighbors from nearest to furthest
+	*/
+	template<typename _Type>
+	static inline void Finish(const std::span<Neighbor<_Type>> _neighbors, const size _count)
+	{
+		std::sort_heap(_neighbors.begin(), _neighbors.begin() + _count, IsCloser<_Type>);
+	}
+};
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_SPATIAL_NEIGHBOR
\ No newline at end of file
@@ -0,0 +1,750 @@
+#pragma once
+#ifndef SLR_SPATIAL_QUADTREE
+#define SLR_SPATIAL_QUADTREE
+
+#include <algorithm>
+#include <span>
+#include <type_traits>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Math/AABB2.hpp"
+#include "SlrLib/Math/Vector2.hpp"
+#include "SlrLib/Memory/Allocation.hpp"
+#include "SlrLib/Spatial/Neighbor.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* A quadtree over Vector2 points within fixed bounds, used to find the points within a region
+* Unlike SpatialHashGrid, the tree adapts to the distribution of the points, so densely and sparsely populated areas are
+* both handled without wasting memory on empty cells.
+* Nodes and points are stored within flat pools which grow as required; each split takes a block of four nodes from the
+* pool and each merge returns it, so no allocation is made per node. A leaf splits once it holds more than the leaf
+* capacity, and a subtree is merged back into a single leaf once it holds no more than the leaf capacity.
+* Points on the boundary between quadrants belong to the quadrant with the greater coordinate.
+*/
+template<typename _Type>
+class Quadtree
+{
+	static_assert(std::is_floating_point<_Type>::value, "Type of quadtree template must be floating point");
+
+public:
+	/**
+	* Default constructor
+	* The tree must be reset with its bounds before any point is inserted
+	*/
+	Quadtree() = default;
+
+	Quadtree(const Quadtree&) = delete;
+	Quadtree& operator=(const Quadtree&) = delete;
+
+	/**
+	* Destructor
+	* Frees the pools of the tree
+	*/
+	~Quadtree()
+	{
+		if (nodes != nullptr)
+		{
+			Status freeStatus = MemFree<Node>(nodes);
+			SLR_ERROR(freeStatus == Status::SUCCESS, "Could not free the node pool");
+		}
+
+		if (items != nullptr)
+		{
+			Status freeStatus = MemFree<Item>(items);
+			SLR_ERROR(freeStatus == Status::SUCCESS, "Could not free the point pool");
+		}
+	}
+
+	/**
+	* Removes every point and sets the bounds of the tree
+	* Points may only be inserted within _minimum to _maximum, inclusive
+	* _leafCapacity is the number of points a leaf may hold before it is split
+	* The pools keep their capacity, so refilling the tree does not allocate
+	*/
+	Status Reset(const Vector2<_Type>& _minimum, const Vector2<_Type>& _maximum, const u32 _leafCapacity = 8)
+	{
+		SLR_ASSERT_ERROR(_minimum.x < _maximum.x && _minimum.y < _maximum.y, "Bounds must have a positive area")
+		{
+			return Status::FAIL;
+		}
+
+		SLR_ASSERT_ERROR(_leafCapacity > 0, "Leaf capacity must be greater than zero")
+		{
+			return Status::FAIL;
+		}
+
+		Status growStatus = Grow<Node>(nodes, nodeCapacity, 1);
+		SLR_ASSERT_ERROR(growStatus == Status::SUCCESS, "Could not allocate the node pool")
+		{
+			return Status::FAIL;
+		}
+
+		this->minimum = _minimum;
+		this->maximum = _maximum;
+		this->leafCapacity = _leafCapacity;
+
+		this->nodes[0] = Node{ invalidIndex, invalidIndex, 0 };
+		this->nodeCount = 1;
+		this->freeBlock = invalidIndex;
+
+		this->itemCount = 0;
+		this->freeItem = invalidIndex;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Inserts a point and returns the ID which identifies it
+	* IDs of removed points are reused
+	*/
+	Status Insert(SLR_RETURN(u32) _id, const Vector2<_Type>& _position)
+	{
+		SLR_ASSERT_ERROR(nodeCount > 0, "Quadtree must be reset before inserting")
+		{
+			return Status::FAIL;
+		}
+
+		SLR_ASSERT_ERROR(
+			_position.x >= minimum.x && _position.x <= maximum.x && _position.y >= minimum.y && _position.y <= maximum.y,
+			"Point is outside of the bounds of the quadtree"
+		)
+		{
+			return Status::FAIL;
+		}
+
+		// Ensure that both pools can hold the point and every split it may cause, so that the insertion cannot fail part way
+		Status nodeStatus = Grow<Node>(nodes, nodeCapacity, size(nodeCount) + 4 * maximumDepth);
+		Status itemStatus = Grow<Item>(items, itemCapacity, size(itemCount) + 1);
+		SLR_ASSERT_ERROR(nodeStatus == Status::SUCCESS && itemStatus == Status::SUCCESS, "Could not grow the pools")
+		{
+			return Status::FAIL;
+		}
+
+		// Take a point from the free list, otherwise from the end of the pool
+		u32 id = freeItem;
+
+		if (id != invalidIndex)
+		{
+			freeItem = items[id].next;
+		}
+		else
+		{
+			id = itemCount++;
+		}
+
+		items[id] = Item{ _position.x, _position.y, invalidIndex, true };
+
+		// Descend to the leaf containing the point, counting it within every node along the way
+		Bounds bounds = GetRootBounds();
+		u32 node = 0;
+		u32 depth = 0;
+
+		while (nodes[node].firstChild != invalidIndex)
+		{
+			++nodes[node].count;
+
+			const u32 quadrant = GetQuadrant(bounds, _position.x, _position.y);
+
+			node = nodes[node].firstChild + quadrant;
+			bounds = GetChildBounds(bounds, quadrant);
+			++depth;
+		}
+
+		Link(node, id);
+
+		if (nodes[node].count > leafCapacity && depth < maximumDepth)
+		{
+			Split(node, bounds, depth);
+		}
+
+		_id = id;
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Removes a point by ID
+	*/
+	Status Remove(const u32 _id)
+	{
+		SLR_ASSERT_ERROR(_id < itemCount && items[_id].isInserted, "Point ID does not identify an inserted point")
+		{
+			return Status::FAIL;
+		}
+
+		const _Type x = items[_id].x;
+		const _Type y = items[_id].y;
+
+		// Descend to the leaf containing the point, remembering the highest node which no longer needs to be split
+		Bounds bounds = GetRootBounds();
+		u32 node = 0;
+		u32 mergeNode = invalidIndex;
+
+		while (nodes[node].firstChild != invalidIndex)
+		{
+			--nodes[node].count;
+
+			if (mergeNode == invalidIndex && nodes[node].count <= leafCapacity)
+			{
+				mergeNode = node;
+			}
+
+			const u32 quadrant = GetQuadrant(bounds, x, y);
+
+			node = nodes[node].firstChild + quadrant;
+			bounds = GetChildBounds(bounds, quadrant);
+		}
+
+		// Unlink the point from the leaf
+		u32* link = &nodes[node].firstItem;
+
+		while (*link != _id)
+		{
+			link = &items[*link].next;
+		}
+
+		*link = items[_id].next;
+		--nodes[node].count;
+
+		// Return the point to the free list
+		items[_id].isInserted = false;
+		items[_id].next = freeItem;
+		freeItem = _id;
+
+		if (mergeNode != invalidIndex)
+		{
+			Merge(mergeNode);
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the position of a point
+	*/
+	Status GetPosition(SLR_RETURN(Vector2<_Type>) _position, const u32 _id) const
+	{
+		SLR_ASSERT_ERROR(_id < itemCount && items[_id].isInserted, "Point ID does not identify an inserted point")
+		{
+			return Status::FAIL;
+		}
+
+		_position = Vector2<_Type>(items[_id].x, items[_id].y);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Calls _callback(id) for every point within _radius of _center, including points on the boundary
+	*/
+	template<typename _Callback>
+	Status QueryRadius(const Vector2<_Type>& _center, const _Type _radius, _Callback&& _callback) const
+	{
+		SLR_ASSERT_ERROR(_radius >= 0, "Radius must not be negative")
+		{
+			return Status::FAIL;
+		}
+
+		const _Type radiusSquared = _radius * _radius;
+
+		Query(
+			Vector2<_Type>(_center.x - _radius, _center.y - _radius),
+			Vector2<_Type>(_center.x + _radius, _center.y + _radius),
+			[&](const Item& _item)
+			{
+				const _Type x = _item.x - _center.x;
+				const _Type y = _item.y - _center.y;
+
+				return (x * x) + (y * y) <= radiusSquared;
+			},
+			_callback
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Calls _callback(id) for every point within the axis-aligned box from _minimum to _maximum, including points on the
+	* boundary
+	*/
+	template<typename _Callback>
+	Status QueryBounds(const Vector2<_Type>& _minimum, const Vector2<_Type>& _maximum, _Callback&& _callback) const
+	{
+		SLR_ASSERT_ERROR(_minimum.x <= _maximum.x && _minimum.y <= _maximum.y, "Minimum of the bounds exceeds the maximum")
+		{
+			return Status::FAIL;
+		}
+
+		Query(
+			_minimum,
+			_maximum,
+			[&](const Item& _item)
+			{
+				return
+					_item.x >= _minimum.x && _item.x <= _maximum.x &&
+					_item.y >= _minimum.y && _item.y <= _maximum.y;
+			},
+			_callback
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Calls _callback(id) for every point within _bounds, including points on the boundary
+	*/
+	template<typename _Callback>
+	Status QueryBounds(const AABB2<_Type>& _bounds, _Callback&& _callback) const
+	{
+		return QueryBounds(_bounds.minimum, _bounds.maximum, _callback);
+	}
+
+	/**
+	* Finds the points nearest to _point, up to the size of _neighbors
+	* _neighbors is filled from nearest to furthest, and _count is set to the number of neighbors found, which is only less
+	* than the size of _neighbors if the tree holds fewer points. Equally distant points are ordered by ID.
+	*/
+	Status KNearest(SLR_RETURN(size) _count, const std::span<Neighbor<_Type>> _neighbors, const Vector2<_Type>& _point) const
+	{
+		_count = 0;
+
+		if (nodeCount == 0 || _neighbors.empty())
+		{
+			return Status::SUCCESS;
+		}
+
+		// Each visited node pushes at most four children, so the stack never exceeds three entries per level plus four
+		SearchEntry stack[3 * maximumDepth + 4];
+		size stackSize = 0;
+
+		const Bounds rootBounds = GetRootBounds();
+		stack[stackSize++] = SearchEntry{ 0, rootBounds, GetDistanceSquared(rootBounds, _point) };
+
+		while (stackSize > 0)
+		{
+			const SearchEntry entry = stack[--stackSize];
+
+			// Nodes which are further than the furthest neighbor found so far cannot contain a closer point
+			if (entry.distanceSquared > NeighborImplementation::GetBound(_neighbors, _count))
+			{
+				continue;
+			}
+
+			const Node& node = nodes[entry.node];
+
+			if (node.firstChild == invalidIndex)
+			{
+				for (u32 id = node.firstItem; id != invalidIndex; id = items[id].next)
+				{
+					const _Type x = items[id].x - _point.x;
+					const _Type y = items[id].y - _point.y;
+
+					NeighborImplementation::Offer(_neighbors, _count, Neighbor<_Type>{ id, (x * x) + (y * y) });
+				}
+
+				continue;
+			}
+
+			// Push the children furthest first, so that the nearest child is searched next and tightens the bound soonest
+			SearchEntry children[4];
+
+			for (u32 quadrant = 0; quadrant < 4; ++quadrant)
+			{
+				const Bounds childBounds = GetChildBounds(entry.bounds, quadrant);
+
+				children[quadrant] = SearchEntry{
+					node.firstChild + quadrant, childBounds, GetDistanceSquared(childBounds, _point)
+				};
+			}
+
+			std::sort(children, children + 4, [](const SearchEntry& _left, const SearchEntry& _right)
+			{
+				return _left.distanceSquared > _right.distanceSquared;
+			});
+
+			for (const SearchEntry& child : children)
+			{
+				if (nodes[child.node].count > 0)
+				{
+					stack[stackSize++] = child;
+				}
+			}
+		}
+
+		NeighborImplementation::Finish(_neighbors, _count);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the number of points within the tree
+	*/
+	inline Status GetSize(SLR_RETURN(size) _size) const
+	{
+		_size = nodeCount > 0 ? nodes[0].count : 0;
+
+		return Status::SUCCESS;
+	}
+
+private:
+	/**
+	* A node of the tree
+	* The children of a node are stored consecutively, ordered by quadrant
+	*/
+	struct Node
+	{
+		/**
+		* The index of the first child, or invalidIndex if the node is a leaf
+		*/
+		u32 firstChild;
+
+		/**
+		* The first point of a leaf, linked through Item::next
+		*/
+		u32 firstItem;
+
+		/**
+		* The number of points within the node, including the points of every descendant
+		*/
+		u32 count;
+	};
+
+	/**
+	* A point stored within the tree
+	*/
+	struct Item
+	{
+		_Type x;
+		_Type y;
+
+		/**
+		* The next point of the same leaf, or of the free list
+		*/
+		u32 next;
+
+		bool isInserted;
+	};
+
+	/**
+	* The area covered by a node
+	* Children are derived from the center of their parent, so neighboring nodes share their edges exactly
+	*/
+	struct Bounds
+	{
+		_Type minimumX;
+		_Type minimumY;
+		_Type maximumX;
+		_Type maximumY;
+	};
+
+	/**
+	* A node waiting to be searched by KNearest(...)
+	*/
+	struct SearchEntry
+	{
+		u32 node;
+		Bounds bounds;
+		_Type distanceSquared;
+	};
+
+	/**
+	* Marks the absence of a node or point
+	*/
+	static constexpr u32 invalidIndex = ~0u;
+
+	/**
+	* The depth at which leaves are no longer split, which bounds the tree for points which are very close together
+	*/
+	static constexpr u32 maximumDepth = 24;
+
+	/**
+	* The pool of nodes; the root is always the first node
+	*/
+	Node* nodes = nullptr;
+
+	/**
+	* The pool of points, indexed by ID
+	*/
+	Item* items = nullptr;
+
+	/**
+	* The number of nodes which have been taken from the pool, including those within the free list
+	*/
+	u32 nodeCount = 0;
+
+	/**
+	* The number of nodes the pool can hold
+	*/
+	u32 nodeCapacity = 0;
+
+	/**
+	* The first block of four unused nodes, linked through Node::firstChild
+	*/
+	u32 freeBlock = invalidIndex;
+
+	/**
+	* The number of points which have been taken from the pool, including those within the free list
+	*/
+	u32 itemCount = 0;
+
+	/**
+	* The number of points the pool can hold
+	*/
+	u32 itemCapacity = 0;
+
+	/**
+	* The first unused point, linked through Item::next
+	*/
+	u32 freeItem = invalidIndex;
+
+	/**
+	* The number of points a leaf may hold before it is split
+	*/
+	u32 leafCapacity = 8;
+
+	/**
+	* The bounds of the tree
+	*/
+	Vector2<_Type> minimum;
+	Vector2<_Type> maximum;
+
+	/**
+	* Grows a pool to hold at least _required elements, preserving its contents
+	*/
+	template<typename _Element>
+	static Status Grow(SLR_RETURN(_Element*) _pool, SLR_RETURN(u32) _capacity, const size _required)
+	{
+		if (_required <= _capacity)
+		{
+			return Status::SUCCESS;
+		}
+
+		const size capacity = std::max<size>({ _required, size(_capacity) * 2, 16 });
+
+		SLR_ASSERT_ERROR(capacity < invalidIndex, "Pool cannot be indexed with 32 bits")
+		{
+			return Status::FAIL;
+		}
+
+		Status status = _pool == nullptr ?
+			MemAlloc<_Element>(_pool, capacity * sizeof(_Element)) :
+			MemRealloc<_Element>(_pool, capacity * sizeof(_Element));
+
+		SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not (re)allocate pool")
+		{
+			return Status::FAIL;
+		}
+
+		_capacity = static_cast<u32>(capacity);
+
+		return Status::SUCCESS;
+	}
+
+	inline Bounds GetRootBounds() const
+	{
+		return Bounds{ minimum.x, minimum.y, maximum.x, maximum.y };
+	}
+
+	/**
+	* Returns the quadrant of a node which contains a position
+	* Bit 0 is set for the right half and bit 1 for the top half
+	*/
+	static inline u32 GetQuadrant(const Bounds& _bounds, const _Type _x, const _Type _y)
+	{
+		const _Type centerX = (_bounds.minimumX + _bounds.maximumX) / 2;
+		const _Type centerY = (_bounds.minimumY + _bounds.maximumY) / 2;
+
+		return static_cast<u32>(_x >= centerX) | (static_cast<u32>(_y >= centerY) << 1);
+	}
+
+	static inline Bounds GetChildBounds(const Bounds& _bounds, const u32 _quadrant)
+	{
+		const _Type centerX = (_bounds.minimumX + _bounds.maximumX) / 2;
+		const _Type centerY = (_bounds.minimumY + _bounds.maximumY) / 2;
+
+		return Bounds{
+			(_quadrant & 1) ? centerX : _bounds.minimumX,
+			(_quadrant & 2) ? centerY : _bounds.minimumY,
+			(_quadrant & 1) ? _bounds.maximumX : centerX,
+			(_quadrant & 2) ? _bounds.maximumY : centerY
+		};
+	}
+
+	/**
+	* Returns the squared distance from a position to the nearest point within the bounds
+	*/
+	static inline _Type GetDistanceSquared(const Bounds& _bounds, const Vector2<_Type>& _point)
+	{
+		const _Type x = std::max<_Type>({ _bounds.minimumX - _point.x, _point.x - _bounds.maximumX, 0 });
+		const _Type y = std::max<_Type>({ _bounds.minimumY - _point.y, _point.y - _bounds.maximumY, 0 });
+
+		return (x * x) + (y * y);
+	}
+
+	/**
+	* Links a point onto a leaf
+	*/
+	inline void Link(const u32 _leaf, const u32 _id)
+	{
+		items[_id].next = nodes[_leaf].firstItem;
+		nodes[_leaf].firstItem = _id;
+		++nodes[_leaf].count;
+	}
+
+	/**
+	* Splits a leaf into four children, then splits any child which holds too many points
+	* The node pool must have room for the splits; refer to Insert(...)
+	*/
+	void Split(const u32 _node, const Bounds& _bounds, const u32 _depth)
+	{
+		// Take a block from the free list, otherwise from the end of the pool
+		u32 block = freeBlock;
+
+		if (block != invalidIndex)
+		{
+			freeBlock = nodes[block].firstChild;
+		}
+		else
+		{
+			block = nodeCount;
+			nodeCount += 4;
+		}
+
+		for (u32 quadrant = 0; quadrant < 4; ++quadrant)
+		{
+			nodes[block + quadrant] = Node{ invalidIndex, invalidIndex, 0 };
+		}
+
+		// Move each point into its quadrant
+		u32 id = nodes[_node].firstItem;
+
+		while (id != invalidIndex)
+		{
+			const u32 next = items[id].next;
+
+			Link(block + GetQuadrant(_bounds, items[id].x, items[id].y), id);
+
+			id = next;
+		}
+
+		nodes[_node].firstChild = block;
+		nodes[_node].firstItem = invalidIndex;
+
+		if (_depth + 1 < maximumDepth)
+		{
+			for (u32 quadrant = 0; quadrant < 4; ++quadrant)
+			{
+				if (nodes[block + quadrant].count > leafCapacity)
+				{
+					Split(block + quadrant, GetChildBounds(_bounds, quadrant), _depth + 1);
+				}
+			}
+		}
+	}
+
+	/**
+	* Turns a node back into a leaf holding every point of its descendants, returning their nodes to the pool
+	*/
+	void Merge(const u32 _node)
+	{
+		u32 firstItem = invalidIndex;
+
+		Gather(_node, firstItem);
+
+		nodes[_node].firstChild = invalidIndex;
+		nodes[_node].firstItem = firstItem;
+	}
+
+	/**
+	* Links every point within a subtree onto _firstItem and returns the blocks of its descendants to the free list
+	*/
+	void Gather(const u32 _node, u32& _firstItem)
+	{
+		const u32 block = nodes[_node].firstChild;
+
+		if (block == invalidIndex)
+		{
+			u32 id = nodes[_node].firstItem;
+
+			while (id != invalidIndex)
+			{
+				const u32 next = items[id].next;
+
+				items[id].next = _firstItem;
+				_firstItem = id;
+
+				id = next;
+			}
+
+			return;
+		}
+
+		for (u32 quadrant = 0; quadrant < 4; ++quadrant)
+		{
+			Gather(block + quadrant, _firstItem);
+		}
+
+		nodes[block].firstChild = freeBlock;
+		freeBlock = block;
+	}
+
+	/**
+	* Calls _callback(id) for every point within the leaves overlapping _minimum to _maximum for which _test(item) is true
+	*/
+	template<typename _Test, typename _Callback>
+	void Query(const Vector2<_Type>& _minimum, const Vector2<_Type>& _maximum, _Test&& _test, _Callback& _callback) const
+	{
+		if (nodeCount == 0)
+		{
+			return;
+		}
+
+		// Each visited node pushes at most four children, so the stack never exceeds three entries per level plus four
+		SearchEntry stack[3 * maximumDepth + 4];
+		size stackSize = 0;
+
+		stack[stackSize++] = SearchEntry{ 0, GetRootBounds(), 0 };
+
+		while (stackSize > 0)
+		{
+			const SearchEntry entry = stack[--stackSize];
+			const Node& node = nodes[entry.node];
+
+			if (node.firstChild == invalidIndex)
+			{
+				for (u32 id = node.firstItem; id != invalidIndex; id = items[id].next)
+				{
+					if (_test(items[id]))
+					{
+						_callback(id);
+					}
+				}
+
+				continue;
+			}
+
+			for (u32 quadrant = 0; quadrant < 4; ++quadrant)
+			{
+				const u32 child = node.firstChild + quadrant;
+				const Bounds bounds = GetChildBounds(entry.bounds, quadrant);
+
+				const bool isOverlapping =
+					bounds.minimumX <= _maximum.x && bounds.maximumX >= _minimum.x &&
+					bounds.minimumY <= _maximum.y && bounds.maximumY >= _minimum.y;
+
+				if (isOverlapping && nodes[child].count > 0)
+				{
+					stack[stackSize++] = SearchEntry{ child, bounds, 0 };
+				}
+			}
+		}
+	}
+};
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_SPATIAL_QUADTREE
\ No newline at end of file
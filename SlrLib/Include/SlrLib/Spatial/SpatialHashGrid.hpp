@@ -0,0 +1,487 @@
+#pragma once
+#ifndef SLR_SPATIAL_SPATIALHASHGRID
+#define SLR_SPATIAL_SPATIALHASHGRID
+
+#include <algorithm>
+#include <bit>
+#include <span>
+#include <type_traits>
+
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Math/AABB2.hpp"
+#include "SlrLib/Math/Vector2.hpp"
+#include "SlrLib/Memory/Allocation.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* A uniform grid over Vector2 points, used to find the points within a region without testing every point
+* Space is divided into square cells and each cell is hashed into a table of buckets, so the grid is unbounded and only
+* uses memory for the points it contains. Each point is identified by its index within the array given to Build(...).
+* Build(...) lays the IDs out with a counting sort, so the IDs of each bucket are stored consecutively and no allocations
+* are made per cell. Only the 4 byte IDs are sorted; positions stay in ID order, so apart from the sort every pass over the
+* points is sequential. The buffers are kept between builds, therefore, rebuilding a grid of a similar size every frame
+* does not allocate.
+* Move(...) updates a single point without rebuilding; a point which leaves the bucket it was built into is linked onto
+* its new bucket until the next call to Build(...).
+* The cell size should be around the radius of a typical query. Coordinates are clamped to +/-2^30 cells.
+*/
+template<typename _Type>
+class SpatialHashGrid
+{
+	static_assert(std::is_floating_point<_Type>::value, "Type of spatial hash grid template must be floating point");
+
+public:
+	/**
+	* Default constructor
+	* The grid contains no points until Build(...) is called
+	*/
+	SpatialHashGrid() = default;
+
+	SpatialHashGrid(const SpatialHashGrid&) = delete;
+	SpatialHashGrid& operator=(const SpatialHashGrid&) = delete;
+
+	/**
+	* Destructor
+	* Frees the buffers of the grid
+	*/
+	~SpatialHashGrid()
+	{
+		Status freeStatus = FreeBuffers();
+		SLR_ERROR(freeStatus == Status::SUCCESS, "Could not free the buffers of the grid");
+	}
+
+	/**
+	* Replaces the contents of the grid with _points, divided into square cells with sides of _cellSize
+	* The ID of each point is its index within _points
+	* The number of buckets is the number of points rounded up to a power of two
+	*/
+	Status Build(const std::span<const Vector2<_Type>> _points, const _Type _cellSize)
+	{
+		SLR_ASSERT_ERROR(_cellSize > 0, "Cell size must be greater than zero")
+		{
+			return Status::FAIL;
+		}
+
+		SLR_ASSERT_ERROR(_points.size() < invalidID, "Too many points for the grid to identify")
+		{
+			return Status::FAIL;
+		}
+
+		const u32 pointCount = static_cast<u32>(_points.size());
+		const u32 bucketCount = std::bit_ceil(std::max(pointCount, 2u));
+
+		// Grow the buffers if they are too small for this build; none of their contents needs to be kept
+		Status reserveStatus = ReserveBuffers(pointCount, bucketCount);
+		SLR_ASSERT_ERROR(reserveStatus == Status::SUCCESS, "Could not allocate the buffers of the grid")
+		{
+			this->pointCount = 0;
+
+			return Status::FAIL;
+		}
+
+		this->pointCount = pointCount;
+		this->bucketShift = 32 - std::countr_zero(bucketCount);
+		this->inverseCellSize = _Type(1) / _cellSize;
+		this->isOverflowInitialized = false;
+
+		std::fill(cellStarts, cellStarts + bucketCount + 1, 0u);
+
+		// Copy the position and store the bucket of each point, in ID order
+		// This is kept separate from counting so that it does not wait on the scattered increments
+		for (u32 i = 0; i < pointCount; ++i)
+		{
+			positions[i] = _points[i];
+			builtBuckets[i] = Hash(Quantize(_points[i].x), Quantize(_points[i].y));
+		}
+
+		// Count the points within each bucket
+		for (u32 i = 0; i < pointCount; ++i)
+		{
+			++cellStarts[builtBuckets[i]];
+		}
+
+		// Convert the counts into the end of each bucket's range
+		for (u32 bucket = 1; bucket < bucketCount; ++bucket)
+		{
+			cellStarts[bucket] += cellStarts[bucket - 1];
+		}
+
+		cellStarts[bucketCount] = pointCount;
+
+		// Place each ID at the end of its bucket's remaining range
+		// Iterating backwards keeps the IDs of each bucket in ascending order, and leaves `cellStarts` holding the start of
+		// each bucket
+		for (u32 i = pointCount; i-- > 0;)
+		{
+			ids[--cellStarts[builtBuckets[i]]] = i;
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Moves a single point to _position without rebuilding the grid
+	*/
+	Status Move(const u32 _id, const Vector2<_Type>& _position)
+	{
+		SLR_ASSERT_ERROR(_id < pointCount, "Point ID is out-of-range")
+		{
+			return Status::FAIL;
+		}
+
+		Vector2<_Type>& position = positions[_id];
+
+		const u32 previousBucket = Hash(Quantize(position.x), Quantize(position.y));
+		const u32 bucket = Hash(Quantize(_position.x), Quantize(_position.y));
+
+		position = _position;
+
+		// The point is still found through the same bucket
+		if (bucket == previousBucket)
+		{
+			return Status::SUCCESS;
+		}
+
+		// The overflow lists are only cleared once a point first changes bucket, so that building remains cheap
+		if (!isOverflowInitialized)
+		{
+			std::fill(overflowHeads, overflowHeads + (size(1) << (32 - bucketShift)), invalidID);
+			isOverflowInitialized = true;
+		}
+
+		// A point is found through the range of the bucket it was built into while it's within that bucket, and through the
+		// overflow list of its current bucket otherwise. The built range doesn't need updating, as a point is only reported
+		// from there if it lies within the cell being visited, which it can't once it hashes to a different bucket.
+		if (previousBucket != builtBuckets[_id])
+		{
+			u32* link = &overflowHeads[previousBucket];
+
+			while (*link != _id)
+			{
+				link = &overflowNext[*link];
+			}
+
+			*link = overflowNext[_id];
+		}
+
+		if (bucket != builtBuckets[_id])
+		{
+			overflowNext[_id] = overflowHeads[bucket];
+			overflowHeads[bucket] = _id;
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Calls _callback(id) for every point within _radius of _center, including points on the boundary
+	* Each point is reported once, in no particular order
+	*/
+	template<typename _Callback>
+	Status QueryRadius(const Vector2<_Type>& _center, const _Type _radius, _Callback&& _callback) const
+	{
+		SLR_ASSERT_ERROR(_radius >= 0, "Radius must not be negative")
+		{
+			return Status::FAIL;
+		}
+
+		const _Type radiusSquared = _radius * _radius;
+
+		Query(
+			Vector2<_Type>(_center.x - _radius, _center.y - _radius),
+			Vector2<_Type>(_center.x + _radius, _center.y + _radius),
+			[&](const Vector2<_Type>& _position)
+			{
+				const _Type x = _position.x - _center.x;
+				const _Type y = _position.y - _center.y;
+
+				return (x * x) + (y * y) <= radiusSquared;
+			},
+			_callback
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Calls _callback(id) for every point within the axis-aligned box from _minimum to _maximum, including points on the
+	* boundary
+	* Each point is reported once, in no particular order
+	*/
+	template<typename _Callback>
+	Status QueryBounds(const Vector2<_Type>& _minimum, const Vector2<_Type>& _maximum, _Callback&& _callback) const
+	{
+		SLR_ASSERT_ERROR(_minimum.x <= _maximum.x && _minimum.y <= _maximum.y, "Minimum of the bounds exceeds the maximum")
+		{
+			return Status::FAIL;
+		}
+
+		Query(
+			_minimum,
+			_maximum,
+			[&](const Vector2<_Type>& _position)
+			{
+				return
+					_position.x >= _minimum.x && _position.x <= _maximum.x &&
+					_position.y >= _minimum.y && _position.y <= _maximum.y;
+			},
+			_callback
+		);
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Calls _callback(id) for every point within _bounds, including points on the boundary
+	*/
+	template<typename _Callback>
+	Status QueryBounds(const AABB2<_Type>& _bounds, _Callback&& _callback) const
+	{
+		return QueryBounds(_bounds.minimum, _bounds.maximum, _callback);
+	}
+
+	/**
+	* Returns the current position of a point
+	*/
+	Status GetPosition(SLR_RETURN(Vector2<_Type>) _position, const u32 _id) const
+	{
+		SLR_ASSERT_ERROR(_id < pointCount, "Point ID is out-of-range")
+		{
+			return Status::FAIL;
+		}
+
+		_position = positions[_id];
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Returns the number of points within the grid
+	*/
+	inline Status GetSize(SLR_RETURN(size) _size) const
+	{
+		_size = this->pointCount;
+
+		return Status::SUCCESS;
+	}
+
+private:
+	/**
+	* Marks the end of an overflow list
+	*/
+	static constexpr u32 invalidID = ~0u;
+
+	/**
+	* The limit, in cells, which coordinates are clamped to so that they can always be represented by an i32
+	*/
+	static constexpr _Type cellLimit = _Type(1 << 30);
+
+	/**
+	* The current position of each point, indexed by ID
+	*/
+	Vector2<_Type>* positions = nullptr;
+
+	/**
+	* The bucket each point was in when the grid was built, indexed by ID
+	*/
+	u32* builtBuckets = nullptr;
+
+	/**
+	* The IDs of the points, grouped by the bucket they were built into
+	*/
+	u32* ids = nullptr;
+
+	/**
+	* The index within `ids` of the first point of each bucket, followed by the number of points
+	* The points of bucket b are stored from cellStarts[b] up to, but excluding, cellStarts[b + 1]
+	*/
+	u32* cellStarts = nullptr;
+
+	/**
+	* The first point of each bucket which moved into the bucket after it was built, or invalidID
+	*/
+	u32* overflowHeads = nullptr;
+
+	/**
+	* The next point within the same overflow list, indexed by ID
+	*/
+	u32* overflowNext = nullptr;
+
+	/**
+	* The number of points within the grid
+	*/
+	u32 pointCount = 0;
+
+	/**
+	* The shift applied to a hash to produce a bucket; the number of buckets is 2^(32 - bucketShift)
+	*/
+	u32 bucketShift = 31;
+
+	/**
+	* The reciprocal of the side length of each cell
+	*/
+	_Type inverseCellSize = 1;
+
+	/**
+	* Whether `overflowHeads` has been cleared since the last call to Build(...)
+	*/
+	bool isOverflowInitialized = false;
+
+	/**
+	* Returns the cell containing a coordinate
+	*/
+	inline i32 Quantize(const _Type _coordinate) const
+	{
+		_Type scaled = _coordinate * inverseCellSize;
+
+		// Written so that NaN is also clamped
+		if (!(scaled >= -cellLimit))
+		{
+			scaled = -cellLimit;
+		}
+		else if (scaled > cellLimit)
+		{
+			scaled = cellLimit;
+		}
+
+		// Round towards negative infinity, as conversion rounds towards zero
+		const i32 truncated = static_cast<i32>(scaled);
+
+		return truncated - static_cast<i32>(scaled < static_cast<_Type>(truncated));
+	}
+
+	/**
+	* Returns the bucket of a cell
+	*/
+	inline u32 Hash(const i32 _cellX, const i32 _cellY) const
+	{
+		const u32 mixed = (static_cast<u32>(_cellX) * 0x9E3779B1u) ^ (static_cast<u32>(_cellY) * 0x85EBCA77u);
+
+		// Take the upper bits of a final multiplication, as they depend on every bit of the mixed value
+		return (mixed * 0xC2B2AE3Du) >> bucketShift;
+	}
+
+	/**
+	* Returns whether a position lies within a cell
+	*/
+	inline bool IsInCell(const Vector2<_Type>& _position, const i32 _cellX, const i32 _cellY) const
+	{
+		return Quantize(_position.x) == _cellX && Quantize(_position.y) == _cellY;
+	}
+
+	/**
+	* Calls _callback(id) for every point within the cells covering _minimum to _maximum for which _test(position) is true
+	*/
+	template<typename _Test, typename _Callback>
+	void Query(const Vector2<_Type>& _minimum, const Vector2<_Type>& _maximum, _Test&& _test, _Callback& _callback) const
+	{
+		if (pointCount == 0)
+		{
+			return;
+		}
+
+		const i32 minimumX = Quantize(_minimum.x);
+		const i32 minimumY = Quantize(_minimum.y);
+		const i32 maximumX = Quantize(_maximum.x);
+		const i32 maximumY = Quantize(_maximum.y);
+
+		const u64 cellCount = u64(i64(maximumX) - minimumX + 1) * u64(i64(maximumY) - minimumY + 1);
+
+		// When the region covers more cells than there are buckets, it is cheaper to test every point
+		if (cellCount > (u64(1) << (32 - bucketShift)))
+		{
+			for (u32 id = 0; id < pointCount; ++id)
+			{
+				if (_test(positions[id]))
+				{
+					_callback(id);
+				}
+			}
+
+			return;
+		}
+
+		for (i32 cellY = minimumY; cellY <= maximumY; ++cellY)
+		{
+			for (i32 cellX = minimumX; cellX <= maximumX; ++cellX)
+			{
+				const u32 bucket = Hash(cellX, cellY);
+
+				// Points of other cells which share the bucket are skipped, as they are reported when their own cell is
+				// visited; this includes points which have since moved to another bucket
+				for (u32 slot = cellStarts[bucket]; slot < cellStarts[bucket + 1]; ++slot)
+				{
+					const u32 id = ids[slot];
+
+					if (IsInCell(positions[id], cellX, cellY) && _test(positions[id]))
+					{
+						_callback(id);
+					}
+				}
+
+				if (isOverflowInitialized)
+				{
+					for (u32 id = overflowHeads[bucket]; id != invalidID; id = overflowNext[id])
+					{
+						if (IsInCell(positions[id], cellX, cellY) && _test(positions[id]))
+						{
+							_callback(id);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	* Ensures every buffer can hold _pointCount points and _bucketCount buckets
+	*/
+	Status ReserveBuffers(const u32 _pointCount, const u32 _bucketCount)
+	{
+		// MemAlloc(...) cannot allocate 0 bytes, so always reserve room for at least one point
+		const size points = std::max(_pointCount, 1u);
+
+		Status statuses[] = {
+			MemReserve<Vector2<_Type>>(positions, points * sizeof(Vector2<_Type>)),
+			MemReserve<u32>(builtBuckets, points * sizeof(u32)),
+			MemReserve<u32>(ids, points * sizeof(u32)),
+			MemReserve<u32>(overflowNext, points * sizeof(u32)),
+			MemReserve<u32>(cellStarts, (size(_bucketCount) + 1) * sizeof(u32)),
+			MemReserve<u32>(overflowHeads, size(_bucketCount) * sizeof(u32))
+		};
+
+		for (const Status status : statuses)
+		{
+			SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not reserve buffer")
+			{
+				return Status::FAIL;
+			}
+		}
+
+		return Status::SUCCESS;
+	}
+
+	/**
+	* Frees every buffer which has been allocated
+	*/
+	Status FreeBuffers()
+	{
+		Status result = Status::SUCCESS;
+
+		if (positions != nullptr && MemFree<Vector2<_Type>>(positions) == Status::FAIL) { result = Status::FAIL; }
+		if (builtBuckets != nullptr && MemFree<u32>(builtBuckets) == Status::FAIL) { result = Status::FAIL; }
+		if (ids != nullptr && MemFree<u32>(ids) == Status::FAIL) { result = Status::FAIL; }
+		if (overflowNext != nullptr && MemFree<u32>(overflowNext) == Status::FAIL) { result = Status::FAIL; }
+		if (cellStarts != nullptr && MemFree<u32>(cellStarts) == Status::FAIL) { result = Status::FAIL; }
+		if (overflowHeads != nullptr && MemFree<u32>(overflowHeads) == Status::FAIL) { result = Status::FAIL; }
+
+		return result;
+	}
+};
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_SPATIAL_SPATIALHASHGRID
\ No newline at end of file
@@ -0,0 +1,250 @@
+#pragma once
+#ifndef SLR_SPATIAL_SWEEPANDPRUNE
+#define SLR_SPATIAL_SWEEPANDPRUNE
+
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "SlrLib/Containers/DynamicArray.hpp"
+#include "SlrLib/ErrorHandling/Exception.hpp"
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Math/AABB2.hpp"
+#include "SlrLib/Memory/Allocation.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* A sort-and-sweep broadphase, used to find every pair of intersecting boxes within an array
+* The boxes are sorted by their minimum x, then swept in order; each box is only tested against the boxes which start
+* before it ends on the x axis, and those are tested on the y axis in batches.
+* The sorted order is kept between calls. While the number of boxes stays the same, the previous order is corrected with
+* an insertion sort, which is close to linear when the boxes move a little each frame; a full sort is used once the order
+* has changed too much.
+* No bound may be NaN, as the boxes couldn't be ordered; infinite bounds are allowed.
+*/
+template<typename _Type>
+class SweepAndPrune
+{
+	static_assert(std::is_arithmetic<_Type>::value, "Type of sweep and prune template must be numeric");
+
+public:
+	/**
+	* Default constructor
+	*/
+	SweepAndPrune() = default;
+
+	SweepAndPrune(const SweepAndPrune&) = delete;
+	SweepAndPrune& operator=(const SweepAndPrune&) = delete;
+
+	/**
+	* Destructor
+	* Frees the buffers of the broadphase
+	*/
+	~SweepAndPrune()
+	{
+		_Type* components[] = { minimumX, minimumY, maximumX, maximumY };
+
+		for (_Type* component : components)
+		{
+			if (component != nullptr)
+			{
+				Status freeStatus = MemFree<_Type>(component);
+				SLR_ERROR(freeStatus == Status::SUCCESS, "Could not free the sorted boxes");
+			}
+		}
+
+		if (order != nullptr)
+		{
+			Status freeStatus = MemFree<u32>(order);
+			SLR_ERROR(freeStatus == Status::SUCCESS, "Could not free the sorted order");
+		}
+	}
+
+	/**
+	* Replaces _pairs with every pair of intersecting boxes within _boxes
+	* Each pair is identified by the indices of the boxes within _boxes, with the lower index first. The order of the pairs
+	* is unspecified.
+	* Fails without finding any pairs if a bound of any box is NaN.
+	*/
+	Status FindPairs(SLR_RETURN(DynamicArray<AABB2Pair>) _pairs, const std::span<const AABB2<_Type>> _boxes)
+	{
+		SLR_ASSERT_ERROR(_boxes.size() < std::numeric_limits<u32>::max(), "Too many boxes to identify")
+		{
+			return Status::FAIL;
+		}
+
+		_pairs.RemoveAll();
+
+		const u32 count = static_cast<u32>(_boxes.size());
+
+		// NaN would break the strict weak ordering the sorts rely on, so reject it before sorting; only NaN compares unequal
+		// to itself
+		for (const AABB2<_Type>& box : _boxes)
+		{
+			const bool isOrdered = box.minimum.x == box.minimum.x && box.minimum.y == box.minimum.y &&
+				box.maximum.x == box.maximum.x && box.maximum.y == box.maximum.y;
+
+			SLR_ASSERT_ERROR(isOrdered, "Boxes must not have NaN bounds")
+			{
+				return Status::FAIL;
+			}
+		}
+
+		Status sortStatus = Sort(_boxes);
+		SLR_ASSERT_ERROR(sortStatus == Status::SUCCESS, "Could not sort the boxes")
+		{
+			return Status::FAIL;
+		}
+
+		// Gather the boxes in sorted order, so that the sweep reads each component consecutively
+		for (u32 i = 0; i < count; ++i)
+		{
+			const AABB2<_Type>& box = _boxes[order[i]];
+
+			minimumX[i] = box.minimum.x;
+			minimumY[i] = box.minimum.y;
+			maximumX[i] = box.maximum.x;
+			maximumY[i] = box.maximum.y;
+		}
+
+		const AABB2SoA<const _Type> sorted(
+			std::span<const _Type>(minimumX, count),
+			std::span<const _Type>(minimumY, count),
+			std::span<const _Type>(maximumX, count),
+			std::span<const _Type>(maximumY, count)
+		);
+
+		Status status = Status::SUCCESS;
+
+		for (u32 i = 0; i < count; ++i)
+		{
+			// The boxes which start within this box on the x axis are the ones following it, up to the first which starts
+			// after it ends
+			const u32 last = static_cast<u32>(
+				std::upper_bound(minimumX + i + 1, minimumX + count, maximumX[i]) - minimumX
+			);
+
+			const AABB2<_Type> box(Vector2<_Type>(minimumX[i], minimumY[i]), Vector2<_Type>(maximumX[i], maximumY[i]));
+
+			AABB2Implementation::ForEachIntersecting<_Type>(sorted, box, i + 1, last, [&](const size _index)
+			{
+				const u32 first = order[i];
+				const u32 second = order[_index];
+
+				const AABB2Pair pair = first < second ? AABB2Pair{ first, second } : AABB2Pair{ second, first };
+
+				if (_pairs.Add(pair) != Status::SUCCESS)
+				{
+					status = Status::FAIL;
+				}
+			});
+		}
+
+		SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not add every pair")
+		{
+			return Status::FAIL;
+		}
+
+		return Status::SUCCESS;
+	}
+
+private:
+	/**
+	* The indices of the boxes from the previous call, sorted by minimum x
+	*/
+	u32* order = nullptr;
+
+	/**
+	* The components of the boxes in sorted order
+	*/
+	_Type* minimumX = nullptr;
+	_Type* minimumY = nullptr;
+	_Type* maximumX = nullptr;
+	_Type* maximumY = nullptr;
+
+	/**
+	* The number of boxes within `order`
+	*/
+	u32 orderCount = 0;
+
+	/**
+	* Sorts `order` by the minimum x of each box
+	*/
+	Status Sort(const std::span<const AABB2<_Type>> _boxes)
+	{
+		const u32 count = static_cast<u32>(_boxes.size());
+
+		const auto isBefore = [&](const u32 _left, const u32 _right)
+		{
+			return _boxes[_left].minimum.x < _boxes[_right].minimum.x;
+		};
+
+		// The previous order can only be reused if it holds the same boxes
+		if (count != orderCount || order == nullptr)
+		{
+			// MemAlloc(...) cannot allocate 0 bytes, so always reserve room for at least one box
+			const size reserved = std::max<size>(count, 1);
+
+			Status statuses[] = {
+				MemReserve<u32>(order, reserved * sizeof(u32)),
+				MemReserve<_Type>(minimumX, reserved * sizeof(_Type)),
+				MemReserve<_Type>(minimumY, reserved * sizeof(_Type)),
+				MemReserve<_Type>(maximumX, reserved * sizeof(_Type)),
+				MemReserve<_Type>(maximumY, reserved * sizeof(_Type))
+			};
+
+			for (const Status status : statuses)
+			{
+				SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not reserve buffer")
+				{
+					orderCount = 0;
+
+					return Status::FAIL;
+				}
+			}
+
+			for (u32 i = 0; i < count; ++i)
+			{
+				order[i] = i;
+			}
+
+			orderCount = count;
+
+			std::sort(order, order + count, isBefore);
+
+			return Status::SUCCESS;
+		}
+
+		// Correct the previous order with an insertion sort, giving up once it has moved too many boxes
+		const size shiftLimit = 8 * size(count);
+		size shifts = 0;
+
+		for (u32 i = 1; i < count && shifts <= shiftLimit; ++i)
+		{
+			const u32 index = order[i];
+			u32 j = i;
+
+			for (; j > 0 && isBefore(index, order[j - 1]); --j)
+			{
+				order[j] = order[j - 1];
+			}
+
+			order[j] = index;
+			shifts += i - j;
+		}
+
+		if (shifts > shiftLimit)
+		{
+			std::sort(order, order + count, isBefore);
+		}
+
+		return Status::SUCCESS;
+	}
+};
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_SPATIAL_SWEEPANDPRUNE
\ No newline at end of file
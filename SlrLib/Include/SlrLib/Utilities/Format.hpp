@@ -0,0 +1,231 @@
+/**
+* The functions contained within this file are used while logging, therefore, like those within Exception.hpp, they do not
+* return Status and can never fail or log a message. Output which doesn't fit within the buffer is truncated.
+*/
+
+#pragma once
+#ifndef SLR_UTILITIES_FORMAT
+#define SLR_UTILITIES_FORMAT
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "SlrLib/Internal/Namespace.hpp"
+#include "SlrLib/Utilities/Types.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* The result of formatting into a fixed buffer
+*/
+struct FormatResult
+{
+	// The number of characters written to the buffer
+	size length;
+
+	// Whether the output did not fit in the buffer and was cut short
+	bool isTruncated;
+};
+
+/**
+* This class is purely to hide the implementation from the user to make it clear not to interact with anything contained
+* within
+*/
+class FormatImplementation
+{
+public:
+	/**
+	* Where formatted characters are written to
+	*/
+	struct Output
+	{
+		char8* data;
+		size capacity;
+		size length;
+		bool isTruncated;
+
+		/**
+		* Appends as much of _text as fits
+		*/
+		inline void Append(const std::string_view _text)
+		{
+			const size available = capacity - length;
+			const size count = _text.size() < available ? _text.size() : available;
+
+			if (count > 0)
+			{
+				std::memcpy(data + length, _text.data(), count);
+			}
+
+			length += count;
+			isTruncated = isTruncated || count < _text.size();
+		}
+	};
+
+	/**
+	* Appends the text representation of _value
+	* Integers and floating point values are written in their shortest round-trip form, enums as their underlying value,
+	* and pointers in hexadecimal
+	*/
+	template<typename _Type>
+	static inline void AppendValue(Output& _output, const _Type& _value)
+	{
+		using Type = std::remove_cv_t<_Type>;
+
+		if constexpr (std::is_same_v<Type, bool>)
+		{
+			_output.Append(_value ? "true" : "false");
+		}
+		else if constexpr (std::is_same_v<Type, char8>)
+		{
+			_output.Append(std::string_view(&_value, 1));
+		}
+		else if constexpr (std::is_enum_v<Type>)
+		{
+			AppendValue(_output, static_cast<std::underlying_type_t<Type>>(_value));
+		}
+		else if constexpr (std::is_arithmetic_v<Type>)
+		{
+			char8 text[64];
+			const std::to_chars_result result = std::to_chars(text, text + sizeof(text), _value);
+
+			_output.Append(std::string_view(text, result.ptr - text));
+		}
+		else if constexpr (std::is_convertible_v<const Type&, std::string_view>)
+		{
+			if constexpr (std::is_pointer_v<Type>)
+			{
+				if (_value == nullptr)
+				{
+					_output.Append("(null)");
+
+					return;
+				}
+			}
+
+			_output.Append(std::string_view(_value));
+		}
+		else
+		{
+			static_assert(std::is_pointer_v<Type>, "Formatted arguments must be arithmetic, enums, strings or pointers");
+
+			char8 text[2 + 2 * sizeof(void*)] = { '0', 'x' };
+			const std::to_chars_result result = std::to_chars(text + 2, text + sizeof(text), reinterpret_cast<std::uintptr_t>(_value), 16);
+
+			_output.Append(std::string_view(text, result.ptr - text));
+		}
+	}
+
+	/**
+	* Appends _format up to and including the next placeholder, writing escaped braces as single braces
+	* Returns the number of characters of _format consumed, and sets _isPlaceholder to whether a placeholder was reached
+	*/
+	static inline size AppendUntilPlaceholder(Output& _output, const std::string_view _format, bool& _isPlaceholder)
+	{
+		size i = 0;
+		size literalStart = 0;
+
+		for (; i < _format.size(); ++i)
+		{
+			const char8 character = _format[i];
+
+			if ((character != '{' && character != '}') || i + 1 >= _format.size())
+			{
+				continue;
+			}
+
+			// `{{` and `}}` are written as a single brace
+			if (_format[i + 1] == character)
+			{
+				_output.Append(_format.substr(literalStart, i + 1 - literalStart));
+
+				literalStart = i + 2;
+				++i;
+
+				continue;
+			}
+
+			if (character == '{' && _format[i + 1] == '}')
+			{
+				_output.Append(_format.substr(literalStart, i - literalStart));
+
+				_isPlaceholder = true;
+
+				return i + 2;
+			}
+		}
+
+		_output.Append(_format.substr(literalStart));
+
+		_isPlaceholder = false;
+
+		return _format.size();
+	}
+
+	/**
+	* Appends the remainder of _format, substituting each placeholder with the next argument
+	* Arguments without a placeholder are appended at the end, separated by spaces; placeholders without an argument are
+	* written as-is
+	*/
+	template<typename _Argument, typename ... _Arguments>
+	static inline void AppendFormatted(Output& _output, std::string_view _format, const _Argument& _argument, const _Arguments& ... _arguments)
+	{
+		bool isPlaceholder;
+
+		_format.remove_prefix(AppendUntilPlaceholder(_output, _format, isPlaceholder));
+
+		if (!isPlaceholder)
+		{
+			_output.Append(" ");
+		}
+
+		AppendValue(_output, _argument);
+
+		AppendFormatted(_output, _format, _arguments...);
+	}
+
+	/**
+	* Appends the remainder of _format once every argument has been used
+	*/
+	static inline void AppendFormatted(Output& _output, std::string_view _format)
+	{
+		while (!_format.empty())
+		{
+			bool isPlaceholder;
+
+			_format.remove_prefix(AppendUntilPlaceholder(_output, _format, isPlaceholder));
+
+			if (isPlaceholder)
+			{
+				_output.Append("{}");
+			}
+		}
+	}
+};
+
+/**
+* Formats _format into _buffer, replacing each `{}` with the next argument
+* `{{` and `}}` are written as `{` and `}`. Arguments may be arithmetic types, enums, strings or pointers. The output is not
+* null terminated, and nothing is allocated.
+* Example usage:
+*     char8 buffer[128];
+*     const FormatResult result = FormatTo(buffer, "Index {} is out of range for size {}", index, elements);
+*     const std::string_view message(buffer, result.length);
+*/
+template<typename ... _Arguments>
+inline FormatResult FormatTo(std::span<char8> _buffer, const std::string_view _format, const _Arguments& ... _arguments)
+{
+	FormatImplementation::Output output = { _buffer.data(), _buffer.size(), 0, false };
+
+	FormatImplementation::AppendFormatted(output, _format, _arguments...);
+
+	return FormatResult{ output.length, output.isTruncated };
+}
+
+SLR_NAMESPACE_END
+
+#endif // ifndef SLR_UTILITIES_FORMAT
\ No newline at end of file
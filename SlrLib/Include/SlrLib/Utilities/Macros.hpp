@@ -8,4 +8,24 @@
 */
 #define SLR_NO_OPERATION static_assert(true)
 
+/**
+* Prevents a function from being inlined
+* This should be used for functions which are rarely called, so that they don't bloat the functions calling them
+*/
+#if defined(_MSC_VER)
+#define SLR_NOINLINE __declspec(noinline)
+#else
+#define SLR_NOINLINE __attribute__((noinline))
+#endif
+
+/**
+* Marks a function as unlikely to be called, so the compiler optimizes it for size and moves it away from hot code
+* MSVC has no equivalent, so this has no effect there
+*/
+#if defined(_MSC_VER)
+#define SLR_COLD
+#else
+#define SLR_COLD __attribute__((cold))
+#endif
+
 #endif // ifndef SLR_UTILITIES_MACROS
\ No newline at end of file
@@ -60,6 +60,13 @@ struct WordSize<8>
 */
 using word = WordSize<sizeof(void*)>::PointerType;
 
+/**
+* Whether _Type can be used as the component of the math types, such as Vector2
+* This is true for the arithmetic types, and is specialized for numeric classes such as Fixed
+*/
+template<typename _Type>
+struct IsNumeric : std::is_arithmetic<_Type> {};
+
 /**
 * Takes _Type and forms ReturnType::Type into _Type as the datatype which should be returned from a function call
 */
@@ -82,8 +89,9 @@ public:
 *         // ...
 *     }
 * For consistency, try to have the return value(s) as the first parameters
+* The macro is variadic so that template types with more than one argument can be given without parentheses
 */
-#define SLR_RETURN(_type) typename ReturnType<_type>::Type
+#define SLR_RETURN(...) typename ReturnType<__VA_ARGS__>::Type
 
 SLR_NAMESPACE_END
 
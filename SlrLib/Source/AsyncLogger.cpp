@@ -0,0 +1,312 @@
+#include "SlrLib/ErrorHandling/AsyncLogger.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <new>
+
+#include "SlrLib/Memory/Allocation.hpp"
+#include "SlrLib/Utilities/Macros.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+AsyncLogger::AsyncLogger(const size _capacity, const AsyncLoggerOverflow _overflow, std::FILE* _stream) :
+	overflow(_overflow),
+	stream(_stream)
+{
+	const size slotCount = std::bit_ceil(std::max<size>(_capacity, 2));
+
+	Status status = MemAlloc<Slot>(slots, slotCount * sizeof(Slot));
+	SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not allocate the message queue; messages will be written synchronously")
+	{
+		slots = nullptr;
+
+		return;
+	}
+
+	status = MemAlloc<char8>(batch, batchBytes);
+	SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not allocate the batch buffer; messages will be written synchronously")
+	{
+		status = MemFree<Slot>(slots);
+		SLR_ERROR(status == Status::SUCCESS, "Could not free the message queue");
+
+		slots = nullptr;
+		batch = nullptr;
+
+		return;
+	}
+
+	// Each slot starts out writable on the first lap of the queue
+	for (size i = 0; i < slotCount; ++i)
+	{
+		new(&slots[i]) Slot();
+		slots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	capacity = slotCount;
+
+	writer = std::thread(&AsyncLogger::WriterLoop, this);
+}
+
+AsyncLogger::~AsyncLogger()
+{
+	if (slots == nullptr)
+	{
+		std::fflush(stream);
+
+		return;
+	}
+
+	// The writer empties the queue before it exits
+	isStopping.store(true, std::memory_order_seq_cst);
+
+	wakeCount.fetch_add(1, std::memory_order_seq_cst);
+	wakeCount.notify_one();
+
+	writer.join();
+
+	Status status = MemFree<char8>(batch);
+	SLR_ERROR(status == Status::SUCCESS, "Could not free the batch buffer");
+
+	status = MemFree<Slot>(slots);
+	SLR_ERROR(status == Status::SUCCESS, "Could not free the message queue");
+}
+
+AsyncLogger& AsyncLogger::operator()(const std::string_view _message, const LogLevel _level, const std::source_location& _sourceLocation)
+{
+	// Without a queue, fall back to writing on this thread
+	if (slots == nullptr)
+	{
+		char8 buffer[512];
+
+		const size length = Format(buffer, sizeof(buffer), _message, _level, _sourceLocation);
+
+		std::fwrite(buffer, 1, length, stream);
+		std::fflush(stream);
+
+		return *this;
+	}
+
+	if (Enqueue(_message, _level, _sourceLocation))
+	{
+		WakeWriter();
+	}
+
+	return *this;
+}
+
+Status AsyncLogger::Flush()
+{
+	if (slots == nullptr)
+	{
+		std::fflush(stream);
+
+		return Status::SUCCESS;
+	}
+
+	// Messages queued after this point aren't waited for
+	const size target = enqueuePosition.load(std::memory_order_acquire);
+
+	size position = writtenPosition.load(std::memory_order_acquire);
+
+	while (position < target)
+	{
+		writtenPosition.wait(position, std::memory_order_acquire);
+
+		position = writtenPosition.load(std::memory_order_acquire);
+	}
+
+	return Status::SUCCESS;
+}
+
+bool AsyncLogger::Enqueue(const std::string_view _message, const LogLevel _level, const std::source_location& _sourceLocation)
+{
+	const size mask = capacity - 1;
+
+	size position = enqueuePosition.load(std::memory_order_relaxed);
+	Slot* slot;
+
+	// Claim a slot
+	while (true)
+	{
+		slot = &slots[position & mask];
+
+		const size sequence = slot->sequence.load(std::memory_order_acquire);
+
+		if (sequence == position)
+		{
+			if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed, std::memory_order_relaxed))
+			{
+				break;
+			}
+
+			continue;
+		}
+
+		// The slot still holds the message from the previous lap, so the queue is full
+		if (static_cast<std::make_signed_t<size>>(sequence - position) < 0)
+		{
+			if (overflow != AsyncLoggerOverflow::BLOCK)
+			{
+				droppedCount.fetch_add(1, std::memory_order_relaxed);
+
+				return false;
+			}
+
+			std::this_thread::yield();
+		}
+
+		// Another thread claimed the position first
+		position = enqueuePosition.load(std::memory_order_relaxed);
+	}
+
+	const size length = std::min(_message.size(), maxMessageLength);
+
+	slot->level = _level;
+	slot->sourceLocation = _sourceLocation;
+	slot->length = length;
+	std::memcpy(slot->message, _message.data(), length);
+
+	// Publish the message to the writer
+	slot->sequence.store(position + 1, std::memory_order_release);
+
+	return true;
+}
+
+void AsyncLogger::WakeWriter()
+{
+	// Pairs with the fence in WriterLoop(); either the writer sees the message or we see that it's sleeping
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	if (isWriterSleeping.load(std::memory_order_relaxed))
+	{
+		wakeCount.fetch_add(1, std::memory_order_release);
+		wakeCount.notify_one();
+	}
+}
+
+void AsyncLogger::WriterLoop()
+{
+	const size mask = capacity - 1;
+
+	while (true)
+	{
+		if (WriteQueued() > 0)
+		{
+			continue;
+		}
+
+		// Anything queued before the logger was destroyed is written before exiting
+		if (isStopping.load(std::memory_order_acquire))
+		{
+			while (WriteQueued() > 0)
+			{
+				SLR_NO_OPERATION;
+			}
+
+			return;
+		}
+
+		const u32 wake = wakeCount.load(std::memory_order_relaxed);
+
+		isWriterSleeping.store(true, std::memory_order_seq_cst);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		// A message may have been queued before we were marked as sleeping, in which case nobody will wake us
+		const size position = writtenPosition.load(std::memory_order_relaxed);
+		const bool isReady = slots[position & mask].sequence.load(std::memory_order_acquire) == position + 1;
+
+		if (!isReady && !isStopping.load(std::memory_order_relaxed))
+		{
+			wakeCount.wait(wake, std::memory_order_acquire);
+		}
+
+		isWriterSleeping.store(false, std::memory_order_relaxed);
+	}
+}
+
+size AsyncLogger::WriteQueued()
+{
+	const size mask = capacity - 1;
+
+	// Leave enough room in the batch for a message and a reasonably long file name
+	constexpr size reserveBytes = maxMessageLength + 320;
+
+	size position = writtenPosition.load(std::memory_order_relaxed);
+	size written = 0;
+	size used = 0;
+
+	// Bound each batch so a steady stream of messages still gets flushed
+	while (written < capacity)
+	{
+		Slot& slot = slots[position & mask];
+
+		if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+		{
+			break;
+		}
+
+		if (batchBytes - used < reserveBytes)
+		{
+			std::fwrite(batch, 1, used, stream);
+
+			used = 0;
+		}
+
+		used += Format(batch + used, batchBytes - used, std::string_view(slot.message, slot.length), slot.level, slot.sourceLocation);
+
+		// Hand the slot back to the logging threads for the next lap
+		slot.sequence.store(position + capacity, std::memory_order_release);
+
+		++position;
+		++written;
+	}
+
+	if (overflow == AsyncLoggerOverflow::COUNT)
+	{
+		const size dropped = droppedCount.load(std::memory_order_relaxed);
+
+		if (dropped != reportedDroppedCount)
+		{
+			if (batchBytes - used < reserveBytes)
+			{
+				std::fwrite(batch, 1, used, stream);
+
+				used = 0;
+			}
+
+			const int length = std::snprintf(
+				batch + used,
+				batchBytes - used,
+				"%s: %zu log messages were dropped because the queue was full\n",
+				GetPrefix(LogLevel::WARNING),
+				dropped - reportedDroppedCount
+			);
+
+			used += std::min<size>(std::max(length, 0), batchBytes - used - 1);
+
+			reportedDroppedCount = dropped;
+		}
+	}
+
+	if (used > 0)
+	{
+		std::fwrite(batch, 1, used, stream);
+	}
+
+	if (written > 0)
+	{
+		std::fflush(stream);
+
+		writtenPosition.store(position, std::memory_order_release);
+		writtenPosition.notify_all();
+	}
+	else if (used > 0)
+	{
+		std::fflush(stream);
+	}
+
+	return written;
+}
+
+SLR_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,179 @@
+#include "SlrLib/Memory/BiasedSharedPointer.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* Marks the calling thread's record as no longer alive when the thread exits
+* An instance of this exists per thread, but is only constructed once the thread creates its first biased shared object
+*/
+class BiasedThreadExit
+{
+public:
+	/**
+	* Destructor
+	* Releases the calling thread's record
+	*/
+	~BiasedThreadExit()
+	{
+		Status status = BiasedSharedImplementation::ExitCurrentThread();
+		SLR_ERROR(status == Status::SUCCESS, "Could not release biased owner thread");
+	}
+};
+
+/**
+* The exit handler for the calling thread
+*/
+static thread_local BiasedThreadExit threadExit;
+
+Status BiasedSharedImplementation::AcquireCurrentThread(SLR_RETURN(BiasedOwnerThread*) _thread)
+{
+	// Create the record the first time this thread creates an object
+	if (currentThread == nullptr)
+	{
+		void* allocation = nullptr;
+		Status status = MemAlloc(allocation, sizeof(BiasedOwnerThread));
+		SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not allocate biased owner thread")
+		{
+			return Status::FAIL;
+		}
+
+		// The thread holds the initial reference
+		currentThread = new(allocation) BiasedOwnerThread();
+
+		// Ensure the exit handler is constructed for this thread so the record is released when it exits
+		static_cast<void>(&threadExit);
+	}
+
+	// Add a reference for the object being created
+	currentThread->references.fetch_add(1, std::memory_order_relaxed);
+
+	_thread = currentThread;
+
+	return Status::SUCCESS;
+}
+
+Status BiasedSharedImplementation::ExitCurrentThread()
+{
+	BiasedOwnerThread* thread = currentThread;
+
+	if (thread == nullptr)
+	{
+		return Status::SUCCESS;
+	}
+
+	// Objects released after this point, by other thread-local destructors, treat this thread as any other thread
+	currentThread = nullptr;
+
+	// This must be ordered before processing the queue; anything queued after this point sees the thread is no longer alive
+	// and processes the queue itself
+	thread->isAlive.store(false, std::memory_order_seq_cst);
+
+	Status processStatus = ProcessQueue(thread);
+	SLR_ASSERT_ERROR(processStatus == Status::SUCCESS, "Could not process biased reference count merge queue")
+	{
+		return Status::FAIL;
+	}
+
+	return ReleaseThread(thread);
+}
+
+Status BiasedSharedImplementation::ReleaseThread(BiasedOwnerThread* _thread)
+{
+	SLR_ASSERT_ERROR(_thread != nullptr, "Cannot release a nullptr thread")
+	{
+		return Status::FAIL;
+	}
+
+	// If this was the final reference, nothing else can refer to the record
+	if (_thread->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		_thread->~BiasedOwnerThread();
+
+		Status status = MemFree<BiasedOwnerThread>(_thread);
+		SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not free biased owner thread")
+		{
+			return Status::FAIL;
+		}
+	}
+
+	return Status::SUCCESS;
+}
+
+Status BiasedSharedImplementation::Enqueue(BiasedReferenceCount* _referenceCount)
+{
+	BiasedOwnerThread* owner = _referenceCount->owner;
+
+	// Hold a reference to the owner while we use it; once the reference count is pushed, the owner may process and destroy
+	// it, which would otherwise release the final reference to the record
+	owner->references.fetch_add(1, std::memory_order_relaxed);
+
+	// Push the reference count onto the owner's queue
+	BiasedReferenceCount* head = owner->queue.load(std::memory_order_relaxed);
+
+	do
+	{
+		_referenceCount->nextQueued = head;
+	} while (!owner->queue.compare_exchange_weak(head, _referenceCount, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+	Status status = Status::SUCCESS;
+
+	// If the owner has exited, it may have already processed its queue for the final time, so we must do it instead
+	if (!owner->isAlive.load(std::memory_order_seq_cst))
+	{
+		status = ProcessQueue(owner);
+	}
+
+	Status releaseStatus = ReleaseThread(owner);
+	SLR_ASSERT_ERROR(status == Status::SUCCESS && releaseStatus == Status::SUCCESS, "Could not queue biased reference count")
+	{
+		return Status::FAIL;
+	}
+
+	return Status::SUCCESS;
+}
+
+Status BiasedSharedImplementation::ProcessQueue(BiasedOwnerThread* _thread)
+{
+	SLR_ASSERT_ERROR(_thread != nullptr, "Cannot process the queue of a nullptr thread")
+	{
+		return Status::FAIL;
+	}
+
+	// Take the entire queue at once so that each reference count is processed by exactly one thread
+	BiasedReferenceCount* referenceCount = _thread->queue.exchange(nullptr, std::memory_order_acquire);
+
+	while (referenceCount != nullptr)
+	{
+		// Get the next reference count before this one is potentially destroyed
+		BiasedReferenceCount* next = referenceCount->nextQueued;
+
+		// Merge the biased count into the shared count, unless the owner has already done so
+		if (!referenceCount->isMerged)
+		{
+			const i64 biasedCount = static_cast<i64>(referenceCount->biasedCount);
+
+			referenceCount->isMerged = true;
+			referenceCount->biasedCount = 0;
+
+			referenceCount->sharedCount.fetch_add(
+				biasedCount * BiasedReferenceCount::one | BiasedReferenceCount::merged,
+				std::memory_order_acq_rel
+			);
+		}
+
+		// Clear the queued flag so the final reference destroys the object as normal; if there are no references left,
+		// nobody else will destroy it, so we must
+		const i64 previous = referenceCount->sharedCount.fetch_and(~BiasedReferenceCount::queued, std::memory_order_acq_rel);
+
+		if ((previous >> 2) == 0)
+		{
+			referenceCount->destroy(referenceCount);
+		}
+
+		referenceCount = next;
+	}
+
+	return Status::SUCCESS;
+}
+
+SLR_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,634 @@
+#include "SlrLib/ErrorHandling/BinaryLog.hpp"
+
+#include <charconv>
+
+#include "SlrLib/Memory/Allocation.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* The bytes every binary log starts with, which also identify the version of the format
+*/
+static constexpr char8 binaryLogMagic[8] = { 'S', 'L', 'R', 'B', 'L', 'O', 'G', '1' };
+
+/**
+* The type of each record within a binary log
+* A descriptor record is written before any chunk which contains a message using it
+*/
+enum class BinaryLogRecord : u8
+{
+	DESCRIPTOR,
+	CHUNK
+};
+
+std::mutex BinaryLogImplementation::mutex;
+std::FILE* BinaryLogImplementation::stream = nullptr;
+DynamicArray<BinaryLogDescriptor> BinaryLogImplementation::descriptors;
+
+BinaryLogThreadBuffer::~BinaryLogThreadBuffer()
+{
+	if (data == nullptr)
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(BinaryLogImplementation::mutex);
+
+		BinaryLogImplementation::FlushThreadBuffer(*this);
+	}
+
+	Status status = MemFree<byte>(data);
+	SLR_ERROR(status == Status::SUCCESS, "Could not free binary log buffer");
+}
+
+u32 BinaryLogImplementation::RegisterDescriptor(const BinaryLogDescriptor& _descriptor)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	size descriptorId;
+	descriptors.GetSize(descriptorId);
+
+	Status status = descriptors.Add(_descriptor);
+	SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not register binary log call site")
+	{
+		return invalidDescriptorId;
+	}
+
+	if (stream != nullptr)
+	{
+		WriteDescriptor(static_cast<u32>(descriptorId), _descriptor);
+	}
+
+	return static_cast<u32>(descriptorId);
+}
+
+bool BinaryLogImplementation::MakeSpace(const size _recordBytes)
+{
+	BinaryLogThreadBuffer& buffer = threadBuffer;
+
+	if (buffer.data == nullptr)
+	{
+		Status status = MemAlloc<byte>(buffer.data, bufferBytes);
+		SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not allocate binary log buffer")
+		{
+			buffer.data = nullptr;
+
+			return false;
+		}
+
+		buffer.capacity = bufferBytes;
+	}
+	else
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		FlushThreadBuffer(buffer);
+	}
+
+	SLR_ASSERT_WARNING(_recordBytes <= bufferBytes, "Binary log message is too large for the buffer and was discarded")
+	{
+		return false;
+	}
+
+	return true;
+}
+
+void BinaryLogImplementation::FlushThreadBuffer(BinaryLogThreadBuffer& _buffer)
+{
+	if (_buffer.used == 0)
+	{
+		return;
+	}
+
+	// If the log was closed, whatever the thread had buffered is discarded
+	if (stream != nullptr)
+	{
+		const BinaryLogRecord record = BinaryLogRecord::CHUNK;
+		const u32 bytes = static_cast<u32>(_buffer.used);
+
+		std::fwrite(&record, sizeof(record), 1, stream);
+		std::fwrite(&bytes, sizeof(bytes), 1, stream);
+		std::fwrite(_buffer.data, 1, _buffer.used, stream);
+	}
+
+	_buffer.used = 0;
+}
+
+void BinaryLogImplementation::WriteDescriptor(const u32 _descriptorId, const BinaryLogDescriptor& _descriptor)
+{
+	const auto writeString = [](const std::string_view _string)
+	{
+		const u32 length = static_cast<u32>(_string.size());
+
+		std::fwrite(&length, sizeof(length), 1, stream);
+		std::fwrite(_string.data(), 1, length, stream);
+	};
+
+	const BinaryLogRecord record = BinaryLogRecord::DESCRIPTOR;
+	const u8 level = static_cast<u8>(_descriptor.level);
+	const u32 line = static_cast<u32>(_descriptor.sourceLocation.line());
+	const u32 argumentCount = static_cast<u32>(_descriptor.arguments.size());
+
+	std::fwrite(&record, sizeof(record), 1, stream);
+	std::fwrite(&_descriptorId, sizeof(_descriptorId), 1, stream);
+	std::fwrite(&level, sizeof(level), 1, stream);
+	std::fwrite(&line, sizeof(line), 1, stream);
+	std::fwrite(&argumentCount, sizeof(argumentCount), 1, stream);
+
+	if (argumentCount > 0)
+	{
+		std::fwrite(_descriptor.arguments.data(), sizeof(BinaryLogArgument), argumentCount, stream);
+	}
+
+	writeString(_descriptor.format);
+	writeString(_descriptor.sourceLocation.file_name());
+	writeString(_descriptor.sourceLocation.function_name());
+}
+
+Status OpenBinaryLog(std::FILE* _stream)
+{
+	SLR_ASSERT_ERROR(_stream != nullptr, "Cannot open a binary log on a nullptr stream")
+	{
+		return Status::FAIL;
+	}
+
+	std::lock_guard<std::mutex> lock(BinaryLogImplementation::mutex);
+
+	SLR_ASSERT_ERROR(BinaryLogImplementation::stream == nullptr, "A binary log is already open")
+	{
+		return Status::FAIL;
+	}
+
+	BinaryLogImplementation::stream = _stream;
+
+	std::fwrite(binaryLogMagic, sizeof(binaryLogMagic), 1, _stream);
+
+	// Call sites registered before the log was opened still need their descriptors
+	std::span<const BinaryLogDescriptor> descriptors;
+	BinaryLogImplementation::descriptors.GetSpan(descriptors);
+
+	for (size i = 0; i < descriptors.size(); ++i)
+	{
+		BinaryLogImplementation::WriteDescriptor(static_cast<u32>(i), descriptors[i]);
+	}
+
+	BinaryLogImplementation::isOpen.store(true, std::memory_order_relaxed);
+
+	return Status::SUCCESS;
+}
+
+Status CloseBinaryLog()
+{
+	std::lock_guard<std::mutex> lock(BinaryLogImplementation::mutex);
+
+	SLR_ASSERT_ERROR(BinaryLogImplementation::stream != nullptr, "No binary log is open")
+	{
+		return Status::FAIL;
+	}
+
+	BinaryLogImplementation::FlushThreadBuffer(BinaryLogImplementation::threadBuffer);
+
+	std::fflush(BinaryLogImplementation::stream);
+
+	BinaryLogImplementation::isOpen.store(false, std::memory_order_relaxed);
+	BinaryLogImplementation::stream = nullptr;
+
+	return Status::SUCCESS;
+}
+
+Status FlushBinaryLog()
+{
+	std::lock_guard<std::mutex> lock(BinaryLogImplementation::mutex);
+
+	SLR_ASSERT_ERROR(BinaryLogImplementation::stream != nullptr, "No binary log is open")
+	{
+		return Status::FAIL;
+	}
+
+	BinaryLogImplementation::FlushThreadBuffer(BinaryLogImplementation::threadBuffer);
+
+	std::fflush(BinaryLogImplementation::stream);
+
+	return Status::SUCCESS;
+}
+
+/**
+* A descriptor read back from a binary log
+* The strings and argument encodings are offsets into the decoder's text buffer
+*/
+struct DecodedBinaryLogDescriptor
+{
+	bool isValid;
+	LogLevel level;
+	u32 line;
+	size argumentsOffset;
+	size argumentCount;
+	size formatOffset;
+	size formatLength;
+	size fileOffset;
+	size fileLength;
+};
+
+/**
+* Reads _bytes bytes from _input to the end of _buffer, returning the offset they were written at
+*/
+static Status ReadToBuffer(SLR_RETURN(size) _offset, DynamicArray<char8>& _buffer, std::FILE* _input, const size _bytes)
+{
+	_buffer.GetSize(_offset);
+
+	Status status = _buffer.Resize(_offset + _bytes);
+	SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not grow the binary log decode buffer")
+	{
+		return Status::FAIL;
+	}
+
+	std::span<char8> buffer;
+	_buffer.GetSpan(buffer);
+
+	SLR_ASSERT_ERROR(std::fread(buffer.data() + _offset, 1, _bytes, _input) == _bytes, "Binary log is truncated")
+	{
+		return Status::FAIL;
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Reads a value of type _Type from _input
+*/
+template<typename _Type>
+static Status ReadValue(SLR_RETURN(_Type) _value, std::FILE* _input)
+{
+	SLR_ASSERT_ERROR(std::fread(&_value, sizeof(_Type), 1, _input) == 1, "Binary log is truncated")
+	{
+		return Status::FAIL;
+	}
+
+	return Status::SUCCESS;
+}
+
+/**
+* Reads a u32 length followed by that many characters into _text
+*/
+static Status ReadString(SLR_RETURN(size) _offset, SLR_RETURN(size) _length, DynamicArray<char8>& _text, std::FILE* _input)
+{
+	u32 length;
+
+	Status status = ReadValue<u32>(length, _input);
+	SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not read string length")
+	{
+		return Status::FAIL;
+	}
+
+	_length = length;
+
+	if (length == 0)
+	{
+		return _text.GetSize(_offset);
+	}
+
+	return ReadToBuffer(_offset, _text, _input, length);
+}
+
+/**
+* Reads a value of type _Type from a chunk, advancing _cursor past it
+*/
+template<typename _Type>
+static Status DecodeValue(SLR_RETURN(_Type) _value, SLR_RETURN(const char8*) _cursor, const char8* _end)
+{
+	SLR_ASSERT_ERROR(static_cast<size>(_end - _cursor) >= sizeof(_Type), "Binary log message is truncated")
+	{
+		return Status::FAIL;
+	}
+
+	std::memcpy(&_value, _cursor, sizeof(_Type));
+	_cursor += sizeof(_Type);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Renders a single argument from a chunk to _output, advancing _cursor past it
+*/
+static Status DecodeArgument(std::FILE* _output, const BinaryLogArgument _argument, SLR_RETURN(const char8*) _cursor, const char8* _end)
+{
+	char8 text[64];
+	std::to_chars_result result = { text, std::errc() };
+	Status status = Status::SUCCESS;
+
+	switch (_argument)
+	{
+	case BinaryLogArgument::SIGNED:
+	{
+		i64 value = 0;
+		status = DecodeValue<i64>(value, _cursor, _end);
+		result = std::to_chars(text, text + sizeof(text), value);
+		break;
+	}
+
+	case BinaryLogArgument::UNSIGNED:
+	{
+		u64 value = 0;
+		status = DecodeValue<u64>(value, _cursor, _end);
+		result = std::to_chars(text, text + sizeof(text), value);
+		break;
+	}
+
+	case BinaryLogArgument::FLOAT:
+	{
+		float value = 0;
+		status = DecodeValue<float>(value, _cursor, _end);
+		result = std::to_chars(text, text + sizeof(text), value);
+		break;
+	}
+
+	case BinaryLogArgument::DOUBLE:
+	{
+		double value = 0;
+		status = DecodeValue<double>(value, _cursor, _end);
+		result = std::to_chars(text, text + sizeof(text), value);
+		break;
+	}
+
+	case BinaryLogArgument::BOOL:
+	{
+		u8 value = 0;
+		status = DecodeValue<u8>(value, _cursor, _end);
+		std::fputs(value != 0 ? "true" : "false", _output);
+		break;
+	}
+
+	case BinaryLogArgument::CHARACTER:
+	{
+		u8 value = 0;
+		status = DecodeValue<u8>(value, _cursor, _end);
+		std::fputc(value, _output);
+		break;
+	}
+
+	case BinaryLogArgument::STRING:
+	{
+		u32 length = 0;
+		status = DecodeValue<u32>(length, _cursor, _end);
+
+		if (status == Status::SUCCESS)
+		{
+			SLR_ASSERT_ERROR(static_cast<size>(_end - _cursor) >= length, "Binary log string is truncated")
+			{
+				return Status::FAIL;
+			}
+
+			std::fwrite(_cursor, 1, length, _output);
+			_cursor += length;
+		}
+		break;
+	}
+
+	case BinaryLogArgument::POINTER:
+	{
+		u64 value = 0;
+		status = DecodeValue<u64>(value, _cursor, _end);
+		text[0] = '0';
+		text[1] = 'x';
+		result = std::to_chars(text + 2, text + sizeof(text), value, 16);
+		break;
+	}
+
+	default:
+		SLR_ERROR(false, "Unknown binary log argument type");
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not decode binary log argument")
+	{
+		return Status::FAIL;
+	}
+
+	std::fwrite(text, 1, result.ptr - text, _output);
+
+	return Status::SUCCESS;
+}
+
+/**
+* Renders every message within a chunk to _output
+*/
+static Status DecodeChunk(
+	std::FILE* _output,
+	std::span<const char8> _chunk,
+	std::span<const DecodedBinaryLogDescriptor> _descriptors,
+	std::span<const char8> _text
+)
+{
+	const char8* cursor = _chunk.data();
+	const char8* end = _chunk.data() + _chunk.size();
+
+	while (cursor < end)
+	{
+		u32 descriptorId = 0;
+
+		Status status = DecodeValue<u32>(descriptorId, cursor, end);
+		SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not read message descriptor")
+		{
+			return Status::FAIL;
+		}
+
+		SLR_ASSERT_ERROR(descriptorId < _descriptors.size() && _descriptors[descriptorId].isValid, "Binary log message refers to an unknown call site")
+		{
+			return Status::FAIL;
+		}
+
+		const DecodedBinaryLogDescriptor& descriptor = _descriptors[descriptorId];
+		const std::string_view format(_text.data() + descriptor.formatOffset, descriptor.formatLength);
+		const BinaryLogArgument* arguments = reinterpret_cast<const BinaryLogArgument*>(_text.data() + descriptor.argumentsOffset);
+
+		std::fputs(Logger::GetPrefix(descriptor.level), _output);
+		std::fputs(": ", _output);
+
+		size argument = 0;
+
+		for (size i = 0; i < format.size(); ++i)
+		{
+			const char8 character = format[i];
+
+			// Escaped braces
+			if ((character == '{' || character == '}') && i + 1 < format.size() && format[i + 1] == character)
+			{
+				std::fputc(character, _output);
+				++i;
+
+				continue;
+			}
+
+			if (character == '{' && i + 1 < format.size() && format[i + 1] == '}' && argument < descriptor.argumentCount)
+			{
+				status = DecodeArgument(_output, arguments[argument++], cursor, end);
+				SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not decode binary log message")
+				{
+					return Status::FAIL;
+				}
+
+				++i;
+
+				continue;
+			}
+
+			std::fputc(character, _output);
+		}
+
+		// Arguments without a placeholder are still consumed so the next message is found
+		for (; argument < descriptor.argumentCount; ++argument)
+		{
+			std::fputc(' ', _output);
+
+			status = DecodeArgument(_output, arguments[argument], cursor, end);
+			SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not decode binary log message")
+			{
+				return Status::FAIL;
+			}
+		}
+
+		// Errors also include where they were logged from, matching AsyncLogger
+		if (descriptor.level == LogLevel::ERROR)
+		{
+			std::fprintf(
+				_output,
+				" (%.*s:%u)",
+				static_cast<int>(descriptor.fileLength),
+				_text.data() + descriptor.fileOffset,
+				static_cast<unsigned int>(descriptor.line)
+			);
+		}
+
+		std::fputc('\n', _output);
+	}
+
+	return Status::SUCCESS;
+}
+
+Status DecodeBinaryLog(std::FILE* _input, std::FILE* _output)
+{
+	SLR_ASSERT_ERROR(_input != nullptr && _output != nullptr, "Cannot decode a binary log with a nullptr stream")
+	{
+		return Status::FAIL;
+	}
+
+	char8 magic[sizeof(binaryLogMagic)];
+
+	SLR_ASSERT_ERROR(
+		std::fread(magic, sizeof(magic), 1, _input) == 1 && std::memcmp(magic, binaryLogMagic, sizeof(magic)) == 0,
+		"Input is not a binary log, or was written by an incompatible version"
+	)
+	{
+		return Status::FAIL;
+	}
+
+	DynamicArray<DecodedBinaryLogDescriptor> descriptors;
+	DynamicArray<char8> text;
+	DynamicArray<char8> chunk;
+
+	BinaryLogRecord record;
+
+	while (std::fread(&record, sizeof(record), 1, _input) == 1)
+	{
+		if (record == BinaryLogRecord::DESCRIPTOR)
+		{
+			u32 descriptorId = 0;
+			u8 level = 0;
+			u32 argumentCount = 0;
+			DecodedBinaryLogDescriptor descriptor = {};
+
+			Status status = ReadValue<u32>(descriptorId, _input);
+			status = (status == Status::SUCCESS) ? ReadValue<u8>(level, _input) : status;
+			status = (status == Status::SUCCESS) ? ReadValue<u32>(descriptor.line, _input) : status;
+			status = (status == Status::SUCCESS) ? ReadValue<u32>(argumentCount, _input) : status;
+			SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not read binary log descriptor")
+			{
+				return Status::FAIL;
+			}
+
+			descriptor.level = static_cast<LogLevel>(level);
+			descriptor.argumentCount = argumentCount;
+
+			size functionOffset;
+			size functionLength;
+
+			status = (argumentCount > 0) ? ReadToBuffer(descriptor.argumentsOffset, text, _input, argumentCount) : text.GetSize(descriptor.argumentsOffset);
+			status = (status == Status::SUCCESS) ? ReadString(descriptor.formatOffset, descriptor.formatLength, text, _input) : status;
+			status = (status == Status::SUCCESS) ? ReadString(descriptor.fileOffset, descriptor.fileLength, text, _input) : status;
+			status = (status == Status::SUCCESS) ? ReadString(functionOffset, functionLength, text, _input) : status;
+			SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not read binary log descriptor")
+			{
+				return Status::FAIL;
+			}
+
+			descriptor.isValid = true;
+
+			// Descriptors are written in ID order, but leave room for any which are missing
+			size descriptorCount;
+			descriptors.GetSize(descriptorCount);
+
+			if (descriptorId >= descriptorCount)
+			{
+				status = descriptors.Resize(static_cast<size>(descriptorId) + 1);
+				SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not grow the binary log descriptor table")
+				{
+					return Status::FAIL;
+				}
+			}
+
+			std::span<DecodedBinaryLogDescriptor> table;
+			descriptors.GetSpan(table);
+
+			table[descriptorId] = descriptor;
+		}
+		else if (record == BinaryLogRecord::CHUNK)
+		{
+			u32 bytes = 0;
+
+			Status status = ReadValue<u32>(bytes, _input);
+			SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not read binary log chunk size")
+			{
+				return Status::FAIL;
+			}
+
+			status = chunk.Resize(0);
+			SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not clear binary log chunk")
+			{
+				return Status::FAIL;
+			}
+
+			size offset;
+
+			status = ReadToBuffer(offset, chunk, _input, bytes);
+			SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not read binary log chunk")
+			{
+				return Status::FAIL;
+			}
+
+			std::span<const char8> chunkSpan;
+			std::span<const DecodedBinaryLogDescriptor> descriptorSpan;
+			std::span<const char8> textSpan;
+
+			chunk.GetSpan(chunkSpan);
+			descriptors.GetSpan(descriptorSpan);
+			text.GetSpan(textSpan);
+
+			status = DecodeChunk(_output, chunkSpan, descriptorSpan, textSpan);
+			SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not decode binary log chunk")
+			{
+				return Status::FAIL;
+			}
+		}
+		else
+		{
+			SLR_ERROR(false, "Unknown binary log record");
+
+			return Status::FAIL;
+		}
+	}
+
+	return Status::SUCCESS;
+}
+
+SLR_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,248 @@
+#include "SlrLib/Memory/EpochReclamation.hpp"
+
+#include <new>
+
+SLR_NAMESPACE_BEGIN
+
+Status EpochThread::Pin()
+{
+	// Only the outermost pin publishes the epoch
+	if (pinDepth++ > 0)
+	{
+		return Status::SUCCESS;
+	}
+
+	const u64 epoch = domain->epoch.load(std::memory_order_relaxed);
+
+	state.store((epoch << 1) | pinnedBit, std::memory_order_relaxed);
+
+	// The pin must be visible to threads advancing the epoch before we read anything from the lock-free structure
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	return Status::SUCCESS;
+}
+
+Status EpochThread::Unpin()
+{
+	SLR_ASSERT_ERROR(pinDepth > 0, "Attempted to unpin a thread which is not pinned")
+	{
+		return Status::FAIL;
+	}
+
+	// Only the outermost unpin allows the epoch to advance
+	if (--pinDepth == 0)
+	{
+		state.store(0, std::memory_order_release);
+	}
+
+	return Status::SUCCESS;
+}
+
+Status EpochThread::RetireNode(void* _node, RetireDeleter _deleter)
+{
+	SLR_ASSERT_ERROR(_node != nullptr, "Attempted to retire a nullptr")
+	{
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(_deleter != nullptr, "A deleter must be provided to retire a node")
+	{
+		return Status::FAIL;
+	}
+
+	// Reclaim a batch once enough nodes have built up
+	if (retiredCount >= domain->reclaimThreshold)
+	{
+		Status status = Reclaim();
+		SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not reclaim retired nodes")
+		{
+			return Status::FAIL;
+		}
+	}
+
+	// If nothing could be reclaimed, a thread is most likely stalled while pinned
+	SLR_ASSERT_WARNING(retiredCount < domain->retiredLimit, "Too many unreclaimed nodes to retire another node")
+	{
+		return Status::FAIL;
+	}
+
+	// Any thread which can still read the node is pinned to an epoch no later than the current one
+	const u64 epoch = domain->epoch.load(std::memory_order_seq_cst);
+
+	retired[retiredCount++] = EpochRetiredNode{ RetiredNode{ _node, _deleter }, epoch };
+
+	return Status::SUCCESS;
+}
+
+Status EpochThread::Reclaim()
+{
+	// Advancing the epoch may make more nodes reclaimable; it doesn't matter if it fails
+	bool didAdvance;
+	domain->TryAdvance(didAdvance);
+
+	return ReclaimBefore(domain->epoch.load(std::memory_order_acquire));
+}
+
+Status EpochThread::ReclaimBefore(const u64 _epoch)
+{
+	size keptCount = 0;
+
+	// Go through each retired node, reclaiming those which are safe and compacting the remainder to the front
+	for (size index = 0; index < retiredCount; ++index)
+	{
+		const EpochRetiredNode& node = retired[index];
+
+		// Every thread pinned when the node was retired has since unpinned once the epoch has advanced twice
+		if (node.epoch + 2 <= _epoch)
+		{
+			node.retired.deleter(node.retired.node);
+		}
+		else
+		{
+			retired[keptCount++] = node;
+		}
+	}
+
+	retiredCount = keptCount;
+
+	return Status::SUCCESS;
+}
+
+EpochDomain::EpochDomain(const size _reclaimThreshold, const size _retiredLimit) :
+	reclaimThreshold(_reclaimThreshold < _retiredLimit ? _reclaimThreshold : _retiredLimit),
+	retiredLimit(_retiredLimit > 0 ? _retiredLimit : 1)
+{
+	SLR_WARNING(_retiredLimit > 0, "The retired limit of an epoch domain must be greater than 0");
+}
+
+EpochDomain::~EpochDomain()
+{
+	EpochThread* thread = threads.load(std::memory_order_acquire);
+
+	while (thread != nullptr)
+	{
+		EpochThread* next = thread->next;
+
+		SLR_WARNING(!thread->isInUse.load(std::memory_order_relaxed), "Epoch domain destroyed with a registered thread");
+
+		// No thread can be reading any node now, so reclaim everything
+		Status reclaimStatus = thread->ReclaimBefore(~u64(0));
+		SLR_ERROR(reclaimStatus == Status::SUCCESS, "Could not reclaim retired nodes");
+
+		Status freeRetiredStatus = MemFree<EpochThread::EpochRetiredNode>(thread->retired);
+		SLR_ERROR(freeRetiredStatus == Status::SUCCESS, "Could not free retired node list");
+
+		thread->~EpochThread();
+
+		Status freeThreadStatus = MemFree<EpochThread>(thread);
+		SLR_ERROR(freeThreadStatus == Status::SUCCESS, "Could not free epoch thread");
+
+		thread = next;
+	}
+}
+
+Status EpochDomain::RegisterThread(SLR_RETURN(EpochThread*) _thread)
+{
+	// Reuse a record which has been unregistered, if there is one
+	for (EpochThread* thread = threads.load(std::memory_order_acquire); thread != nullptr; thread = thread->next)
+	{
+		bool isInUse = false;
+
+		if (thread->isInUse.compare_exchange_strong(isInUse, true, std::memory_order_acquire, std::memory_order_relaxed))
+		{
+			// Reclaim whatever the previous thread couldn't
+			Status status = thread->Reclaim();
+			SLR_ERROR(status == Status::SUCCESS, "Could not reclaim retired nodes");
+
+			_thread = thread;
+
+			return Status::SUCCESS;
+		}
+	}
+
+	// Otherwise create a new record
+	void* allocation = nullptr;
+	Status status = MemAlloc(allocation, sizeof(EpochThread));
+	SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not allocate epoch thread")
+	{
+		return Status::FAIL;
+	}
+
+	EpochThread* thread = new(allocation) EpochThread();
+	thread->domain = this;
+	thread->isInUse.store(true, std::memory_order_relaxed);
+
+	// Allocate the retired list up front so retiring a node never allocates
+	status = MemAlloc<EpochThread::EpochRetiredNode>(thread->retired, retiredLimit * sizeof(EpochThread::EpochRetiredNode));
+	SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not allocate retired node list")
+	{
+		thread->~EpochThread();
+		MemFree<EpochThread>(thread);
+
+		return Status::FAIL;
+	}
+
+	// Push the record onto the list of records
+	EpochThread* head = threads.load(std::memory_order_relaxed);
+
+	do
+	{
+		thread->next = head;
+	} while (!threads.compare_exchange_weak(head, thread, std::memory_order_release, std::memory_order_relaxed));
+
+	_thread = thread;
+
+	return Status::SUCCESS;
+}
+
+Status EpochDomain::UnregisterThread(SLR_RETURN(EpochThread*) _thread)
+{
+	SLR_ASSERT_ERROR(_thread != nullptr, "Cannot unregister a nullptr thread")
+	{
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(_thread->pinDepth == 0, "Cannot unregister a thread which is pinned")
+	{
+		return Status::FAIL;
+	}
+
+	// Reclaim as much as possible before giving up the record
+	Status status = _thread->Reclaim();
+	SLR_ERROR(status == Status::SUCCESS, "Could not reclaim retired nodes");
+
+	_thread->isInUse.store(false, std::memory_order_release);
+
+	_thread = nullptr;
+
+	return Status::SUCCESS;
+}
+
+Status EpochDomain::TryAdvance(SLR_RETURN(bool) _didAdvance)
+{
+	_didAdvance = false;
+
+	// Order the loads below after any pins made before this call
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	u64 currentEpoch = epoch.load(std::memory_order_relaxed);
+
+	// The epoch may only advance once every pinned thread has observed the current epoch
+	for (EpochThread* thread = threads.load(std::memory_order_acquire); thread != nullptr; thread = thread->next)
+	{
+		const u64 state = thread->state.load(std::memory_order_relaxed);
+
+		if ((state & EpochThread::pinnedBit) != 0 && (state >> 1) != currentEpoch)
+		{
+			return Status::SUCCESS;
+		}
+	}
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+
+	_didAdvance = epoch.compare_exchange_strong(currentEpoch, currentEpoch + 1, std::memory_order_release, std::memory_order_relaxed);
+
+	return Status::SUCCESS;
+}
+
+SLR_NAMESPACE_END
\ No newline at end of file
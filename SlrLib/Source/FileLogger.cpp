@@ -0,0 +1,324 @@
+#include "SlrLib/ErrorHandling/FileLogger.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#define NOGDI
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include "SlrLib/Memory/Allocation.hpp"
+
+SLR_NAMESPACE_BEGIN
+
+/**
+* Returns the standard output as a file
+*/
+static std::intptr_t GetStandardOutputFile()
+{
+#if defined(_WIN32)
+	return reinterpret_cast<std::intptr_t>(GetStdHandle(STD_OUTPUT_HANDLE));
+#else
+	return STDOUT_FILENO;
+#endif
+}
+
+/**
+* Writes _first followed by _second to _file
+* On POSIX this is a single writev(...) unless the system writes only part of it
+*/
+static Status WriteToFile(const std::intptr_t _file, std::string_view _first, std::string_view _second)
+{
+#if defined(_WIN32)
+	const HANDLE handle = reinterpret_cast<HANDLE>(_file);
+
+	for (std::string_view part : { _first, _second })
+	{
+		while (!part.empty())
+		{
+			const DWORD toWrite = part.size() < 0x40000000 ? static_cast<DWORD>(part.size()) : 0x40000000;
+			DWORD written = 0;
+
+			if (!WriteFile(handle, part.data(), toWrite, &written, nullptr))
+			{
+				return Status::FAIL;
+			}
+
+			part.remove_prefix(written);
+		}
+	}
+#else
+	while (!_first.empty() || !_second.empty())
+	{
+		iovec parts[2];
+		int partCount = 0;
+
+		if (!_first.empty())
+		{
+			parts[partCount++] = iovec{ const_cast<char8*>(_first.data()), _first.size() };
+		}
+
+		if (!_second.empty())
+		{
+			parts[partCount++] = iovec{ const_cast<char8*>(_second.data()), _second.size() };
+		}
+
+		const ssize_t result = writev(static_cast<int>(_file), parts, partCount);
+
+		if (result < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			return Status::FAIL;
+		}
+
+		// Skip over whatever was written, which may end part way through either
+		const size written = static_cast<size>(result);
+		const size fromFirst = written < _first.size() ? written : _first.size();
+
+		_first.remove_prefix(fromFirst);
+		_second.remove_prefix(written - fromFirst);
+	}
+#endif
+
+	return Status::SUCCESS;
+}
+
+FileLogger::FileLogger(const std::string_view _path, const FileLoggerOptions& _options) :
+	options(_options),
+	path(_path),
+	lastFlushTime(std::chrono::steady_clock::now())
+{
+	Status status = Open();
+	SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not open the log file; messages will be written to the standard output")
+	{
+		return;
+	}
+
+	if (options.bufferBytes == 0)
+	{
+		return;
+	}
+
+	status = MemAlloc<char8>(buffer, options.bufferBytes);
+	SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not allocate the log buffer; messages will be written unbuffered")
+	{
+		buffer = nullptr;
+
+		return;
+	}
+
+	bufferCapacity = options.bufferBytes;
+}
+
+FileLogger::~FileLogger()
+{
+	Status status = WriteBuffer(std::string_view());
+	SLR_ERROR(status == Status::SUCCESS, "Could not write buffered log messages");
+
+	Close();
+
+	if (buffer != nullptr)
+	{
+		status = MemFree<char8>(buffer);
+		SLR_ERROR(status == Status::SUCCESS, "Could not free the log buffer");
+	}
+}
+
+FileLogger& FileLogger::operator()(const std::string_view _message, const LogLevel _level, const std::source_location& _sourceLocation)
+{
+	// Format before locking, so threads only contend over copying the line
+	char8 line[maxLineBytes];
+
+	const size length = Format(line, sizeof(line), _message, _level, _sourceLocation);
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// Nothing here can be logged, so failures are only counted
+	if (options.maxFileBytes != 0 && !isStandardOutput && fileBytes > 0 && fileBytes + length > options.maxFileBytes)
+	{
+		if (WriteBuffer(std::string_view()) == Status::SUCCESS)
+		{
+			static_cast<void>(Rotate());
+		}
+	}
+
+	fileBytes += length;
+
+	if (bufferUsed + length <= bufferCapacity)
+	{
+		std::memcpy(buffer + bufferUsed, line, length);
+
+		bufferUsed += length;
+		++bufferedCount;
+	}
+	else
+	{
+		// Write the buffer and the message together rather than copying the message in after
+		static_cast<void>(WriteBuffer(std::string_view(line, length)));
+	}
+
+	if (_level == LogLevel::ERROR && options.isSyncedOnError)
+	{
+		if (WriteBuffer(std::string_view()) == Status::SUCCESS && !isStandardOutput)
+		{
+#if defined(_WIN32)
+			FlushFileBuffers(reinterpret_cast<HANDLE>(file));
+#else
+			fsync(static_cast<int>(file));
+#endif
+		}
+	}
+	else if (bufferUsed > 0 && std::chrono::steady_clock::now() - lastFlushTime >= options.flushInterval)
+	{
+		static_cast<void>(WriteBuffer(std::string_view()));
+	}
+
+	return *this;
+}
+
+Status FileLogger::Flush()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	return WriteBuffer(std::string_view());
+}
+
+Status FileLogger::WriteBuffer(const std::string_view _line)
+{
+	lastFlushTime = std::chrono::steady_clock::now();
+
+	if (bufferUsed == 0 && _line.empty())
+	{
+		return Status::SUCCESS;
+	}
+
+	const Status status = WriteToFile(file, std::string_view(buffer, bufferUsed), _line);
+
+	if (status != Status::SUCCESS)
+	{
+		droppedCount += bufferedCount + (_line.empty() ? 0 : 1);
+	}
+
+	bufferUsed = 0;
+	bufferedCount = 0;
+
+	return status;
+}
+
+Status FileLogger::Rotate()
+{
+	Close();
+
+	if (options.maxFileCount == 0)
+	{
+		std::remove(path.c_str());
+
+		return Open();
+	}
+
+	// Shift `<path>.<n>` to `<path>.<n + 1>`, oldest first so each target is free; std::rename(...) won't replace an
+	// existing file on every platform, so the oldest is removed beforehand
+	std::string from;
+	std::string to = path + '.' + std::to_string(options.maxFileCount);
+
+	std::remove(to.c_str());
+
+	for (size i = options.maxFileCount; i > 1; --i)
+	{
+		from = path + '.' + std::to_string(i - 1);
+
+		std::rename(from.c_str(), to.c_str());
+
+		to.swap(from);
+	}
+
+	std::rename(path.c_str(), to.c_str());
+
+	return Open();
+}
+
+Status FileLogger::Open()
+{
+#if defined(_WIN32)
+	const HANDLE handle = CreateFileA(
+		path.c_str(),
+		FILE_APPEND_DATA,
+		FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+		nullptr,
+		OPEN_ALWAYS,
+		FILE_ATTRIBUTE_NORMAL,
+		nullptr
+	);
+
+	LARGE_INTEGER fileSize;
+
+	if (handle != INVALID_HANDLE_VALUE && GetFileSizeEx(handle, &fileSize))
+	{
+		file = reinterpret_cast<std::intptr_t>(handle);
+		fileBytes = static_cast<u64>(fileSize.QuadPart);
+		isStandardOutput = false;
+
+		return Status::SUCCESS;
+	}
+
+	if (handle != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(handle);
+	}
+#else
+	const int descriptor = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+
+	struct stat fileStatus;
+
+	if (descriptor >= 0 && fstat(descriptor, &fileStatus) == 0)
+	{
+		file = descriptor;
+		fileBytes = static_cast<u64>(fileStatus.st_size);
+		isStandardOutput = false;
+
+		return Status::SUCCESS;
+	}
+
+	if (descriptor >= 0)
+	{
+		close(descriptor);
+	}
+#endif
+
+	file = GetStandardOutputFile();
+	fileBytes = 0;
+	isStandardOutput = true;
+
+	return Status::FAIL;
+}
+
+void FileLogger::Close()
+{
+	if (isStandardOutput || file == invalidFile)
+	{
+		return;
+	}
+
+#if defined(_WIN32)
+	CloseHandle(reinterpret_cast<HANDLE>(file));
+#else
+	close(static_cast<int>(file));
+#endif
+
+	file = invalidFile;
+}
+
+SLR_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,256 @@
+#include "SlrLib/Memory/HazardPointers.hpp"
+
+#include <algorithm>
+#include <new>
+
+SLR_NAMESPACE_BEGIN
+
+Status HazardThread::RetireNode(void* _node, RetireDeleter _deleter)
+{
+	SLR_ASSERT_ERROR(_node != nullptr, "Attempted to retire a nullptr")
+	{
+		return Status::FAIL;
+	}
+
+	SLR_ASSERT_ERROR(_deleter != nullptr, "A deleter must be provided to retire a node")
+	{
+		return Status::FAIL;
+	}
+
+	// At most this many nodes can be protected, so scanning at this many more is guaranteed to reclaim a batch
+	const size totalSlots = domain->threadCount.load(std::memory_order_relaxed) * slotCount;
+	const size retiredLimit = domain->scanThreshold + totalSlots + 1;
+
+	// Grow the retired list if threads have been registered since it was allocated, or if it's full because a previous
+	// scan failed
+	if (retiredCapacity < retiredLimit || retiredCount == retiredCapacity)
+	{
+		const size newCapacity = std::max(retiredLimit, retiredCapacity * 2);
+
+		Status status;
+
+		if (retired == nullptr)
+		{
+			status = MemAlloc<RetiredNode>(retired, newCapacity * sizeof(RetiredNode));
+		}
+		else
+		{
+			status = MemRealloc<RetiredNode>(retired, newCapacity * sizeof(RetiredNode));
+		}
+
+		SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not (re)allocate retired node list")
+		{
+			return Status::FAIL;
+		}
+
+		retiredCapacity = newCapacity;
+	}
+
+	retired[retiredCount++] = RetiredNode{ _node, _deleter };
+
+	// The node is retired from here on, so the caller must not free it even if the scan fails; the scan is retried on the
+	// next retire
+	if (retiredCount >= retiredLimit)
+	{
+		Status status = Scan();
+		SLR_ERROR(status == Status::SUCCESS, "Could not scan hazard slots; retired nodes will be reclaimed later");
+	}
+
+	return Status::SUCCESS;
+}
+
+Status HazardThread::Scan()
+{
+	// The nodes were unlinked before being retired; this orders reading the slots after that
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	size hazardCount = 0;
+
+	// Take a snapshot of every non-null hazard slot
+	for (HazardThread* thread = domain->threads.load(std::memory_order_acquire); thread != nullptr; thread = thread->next)
+	{
+		// Make room for every slot of this thread
+		if (hazardCount + slotCount > hazardsCapacity)
+		{
+			const size newCapacity = (hazardsCapacity * 2) + slotCount;
+
+			Status status;
+
+			if (hazards == nullptr)
+			{
+				status = MemAlloc<void*>(hazards, newCapacity * sizeof(void*));
+			}
+			else
+			{
+				status = MemRealloc<void*>(hazards, newCapacity * sizeof(void*));
+			}
+
+			SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not (re)allocate hazard snapshot")
+			{
+				return Status::FAIL;
+			}
+
+			hazardsCapacity = newCapacity;
+		}
+
+		for (size slot = 0; slot < slotCount; ++slot)
+		{
+			void* hazard = thread->slots[slot].load(std::memory_order_acquire);
+
+			if (hazard != nullptr)
+			{
+				hazards[hazardCount++] = hazard;
+			}
+		}
+	}
+
+	// Sort the snapshot so each retired node can be looked up in logarithmic time
+	std::sort(hazards, hazards + hazardCount);
+
+	size keptCount = 0;
+
+	// Go through each retired node, reclaiming those which are not protected and compacting the remainder to the front
+	for (size index = 0; index < retiredCount; ++index)
+	{
+		const RetiredNode& node = retired[index];
+
+		if (std::binary_search(hazards, hazards + hazardCount, node.node))
+		{
+			retired[keptCount++] = node;
+		}
+		else
+		{
+			node.deleter(node.node);
+		}
+	}
+
+	retiredCount = keptCount;
+
+	return Status::SUCCESS;
+}
+
+Status HazardThread::ReclaimAll()
+{
+	for (size index = 0; index < retiredCount; ++index)
+	{
+		retired[index].deleter(retired[index].node);
+	}
+
+	retiredCount = 0;
+
+	return Status::SUCCESS;
+}
+
+HazardDomain::HazardDomain(const size _scanThreshold) : scanThreshold(_scanThreshold)
+{
+}
+
+HazardDomain::~HazardDomain()
+{
+	HazardThread* thread = threads.load(std::memory_order_acquire);
+
+	while (thread != nullptr)
+	{
+		HazardThread* next = thread->next;
+
+		SLR_WARNING(!thread->isInUse.load(std::memory_order_relaxed), "Hazard domain destroyed with a registered thread");
+
+		// No thread can be reading any node now, so reclaim everything
+		Status reclaimStatus = thread->ReclaimAll();
+		SLR_ERROR(reclaimStatus == Status::SUCCESS, "Could not reclaim retired nodes");
+
+		if (thread->retired != nullptr)
+		{
+			Status status = MemFree<RetiredNode>(thread->retired);
+			SLR_ERROR(status == Status::SUCCESS, "Could not free retired node list");
+		}
+
+		if (thread->hazards != nullptr)
+		{
+			Status status = MemFree<void*>(thread->hazards);
+			SLR_ERROR(status == Status::SUCCESS, "Could not free hazard snapshot");
+		}
+
+		thread->~HazardThread();
+
+		Status freeThreadStatus = MemFree<HazardThread>(thread);
+		SLR_ERROR(freeThreadStatus == Status::SUCCESS, "Could not free hazard thread");
+
+		thread = next;
+	}
+}
+
+Status HazardDomain::RegisterThread(SLR_RETURN(HazardThread*) _thread)
+{
+	// Reuse a record which has been unregistered, if there is one
+	for (HazardThread* thread = threads.load(std::memory_order_acquire); thread != nullptr; thread = thread->next)
+	{
+		bool isInUse = false;
+
+		if (thread->isInUse.compare_exchange_strong(isInUse, true, std::memory_order_acquire, std::memory_order_relaxed))
+		{
+			// Reclaim whatever the previous thread couldn't
+			if (thread->retiredCount > 0)
+			{
+				Status status = thread->Scan();
+				SLR_ERROR(status == Status::SUCCESS, "Could not scan hazard slots");
+			}
+
+			_thread = thread;
+
+			return Status::SUCCESS;
+		}
+	}
+
+	// Otherwise create a new record
+	void* allocation = nullptr;
+	Status status = MemAlloc(allocation, sizeof(HazardThread));
+	SLR_ASSERT_ERROR(status == Status::SUCCESS, "Could not allocate hazard thread")
+	{
+		return Status::FAIL;
+	}
+
+	HazardThread* thread = new(allocation) HazardThread();
+	thread->domain = this;
+	thread->isInUse.store(true, std::memory_order_relaxed);
+
+	// Count the record before it can be seen, so no scan can see more slots than the retired limit accounts for
+	threadCount.fetch_add(1, std::memory_order_relaxed);
+
+	// Push the record onto the list of records
+	HazardThread* head = threads.load(std::memory_order_relaxed);
+
+	do
+	{
+		thread->next = head;
+	} while (!threads.compare_exchange_weak(head, thread, std::memory_order_release, std::memory_order_relaxed));
+
+	_thread = thread;
+
+	return Status::SUCCESS;
+}
+
+Status HazardDomain::UnregisterThread(SLR_RETURN(HazardThread*) _thread)
+{
+	SLR_ASSERT_ERROR(_thread != nullptr, "Cannot unregister a nullptr thread")
+	{
+		return Status::FAIL;
+	}
+
+	_thread->ResetAll();
+
+	// Reclaim as much as possible before giving up the record
+	if (_thread->retiredCount > 0)
+	{
+		Status status = _thread->Scan();
+		SLR_ERROR(status == Status::SUCCESS, "Could not scan hazard slots");
+	}
+
+	_thread->isInUse.store(false, std::memory_order_release);
+
+	_thread = nullptr;
+
+	return Status::SUCCESS;
+}
+
+SLR_NAMESPACE_END
\ No newline at end of file
@@ -1,37 +1,85 @@
 #include "SlrLib/ErrorHandling/Logger.hpp"
 
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
 
+#include "SlrLib/ErrorHandling/Exception.hpp"
+
 SLR_NAMESPACE_BEGIN
 
-DefaultLogger& DefaultLogger::operator()(const std::string_view _message, const LogLevel _level, const std::source_location& _sourceLocation)
+const char* Logger::GetPrefix(const LogLevel _level)
 {
-	/**
-	* This is a temporary implementation
-	*/
-
-	const char* prefix = nullptr;
-
 	switch (_level)
 	{
 	case LogLevel::ERROR:
-		prefix = "[Error]";
-		break;
+		return "[Error]";
 
 	case LogLevel::WARNING:
-		prefix = "[Warning]";
-		break;
+		return "[Warning]";
 
 	case LogLevel::INFO:
-		prefix = "[Info]";
-		break;
+		return "[Info]";
 
 	default:
-		prefix = "[Unknown]";
-		break;
+		return "[Unknown]";
+	}
+}
+
+Status Logger::Flush()
+{
+	return Status::SUCCESS;
+}
+
+size Logger::Format(char8* _buffer, const size _bufferSize, const std::string_view _message, const LogLevel _level, const std::source_location& _sourceLocation)
+{
+	int length;
+
+	// Errors also include where they were logged from
+	if (_level == LogLevel::ERROR)
+	{
+		length = std::snprintf(
+			_buffer,
+			_bufferSize,
+			"%s: %.*s (%s:%u)\n",
+			GetPrefix(_level),
+			static_cast<int>(_message.size()),
+			_message.data(),
+			_sourceLocation.file_name(),
+			static_cast<unsigned int>(_sourceLocation.line())
+		);
+	}
+	else
+	{
+		length = std::snprintf(
+			_buffer,
+			_bufferSize,
+			"%s: %.*s\n",
+			GetPrefix(_level),
+			static_cast<int>(_message.size()),
+			_message.data()
+		);
+	}
+
+	// snprintf returns the length the message would have been, and always leaves room for a null terminator
+	const size written = std::min<size>(std::max(length, 0), _bufferSize - 1);
+
+	// A truncated message still ends its line
+	if (written > 0 && written < static_cast<size>(length))
+	{
+		_buffer[written - 1] = '\n';
 	}
 
-	std::cout << prefix << ": " << _message << std::endl;
+	return written;
+}
+
+DefaultLogger& DefaultLogger::operator()(const std::string_view _message, const LogLevel _level, const std::source_location& _sourceLocation)
+{
+	/**
+	* This is a temporary implementation
+	*/
+
+	std::cout << GetPrefix(_level) << ": " << _message << std::endl;
 
 	return *this;
 }